@@ -8,6 +8,10 @@ if(GXZN_CHRONO_BUILD_TEST)
 	add_subdirectory(${GXZN_CHRONO_TEST_DIR})
 endif()
 
+if(GXZN_CHRONO_BUILD_TOOLS)
+	add_subdirectory(${GXZN_CHRONO_TEST_DIR}/tools)
+endif()
+
 if(GXZN_CHRONO_GENERATE_DOCS)
 	include(${GXZN_CHRONO_ROOT}/cmake/automatics/docs.cmake)
 endif()
@@ -16,6 +16,7 @@ endif()
 option(GXZN_CHRONO_SHOW_SUBMODULE_INFO   "Show submodule info"        ${GXZN_CHRONO_IS_TOPLEVEL_PROJECT})
 option(GXZN_CHRONO_MULTITHREADING_SUPPORT "Multithreading support"    ON)
 option(GXZN_CHRONO_BUILD_TEST           "Build chrono's tests"        ${GXZN_CHRONO_IS_TOPLEVEL_PROJECT})
+option(GXZN_CHRONO_BUILD_TOOLS          "Build chrono's load tools"   OFF)
 option(GXZN_CHRONO_DEV_MODE             "Developer mode"              ${GXZN_CHRONO_IS_TOPLEVEL_PROJECT})
 option(GXZN_CHRONO_GENERATE_INFO_HEADER "Generate info header"        OFF)
 option(GXZN_CHRONO_GENERATE_DOCS        "Generate MCSS documentation" OFF)
@@ -55,6 +56,7 @@ if (GXZN_CHRONO_SHOW_SUBMODULE_INFO)
 
 	if(GXZN_CHRONO_DEV_MODE)
 		message(STATUS "Tests:                  ${GXZN_CHRONO_BUILD_TEST}")
+		message(STATUS "Tools:                  ${GXZN_CHRONO_BUILD_TOOLS}")
 		message(STATUS "Generate info header:   ${GXZN_CHRONO_GENERATE_INFO_HEADER}")
 		message(STATUS "Generate documentation: ${GXZN_CHRONO_GENERATE_DOCS}")
 		message(STATUS "Documentation directory:${GXZN_CHRONO_DOCS_DIR}")
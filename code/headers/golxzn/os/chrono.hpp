@@ -18,6 +18,31 @@
  * - [golxzn::os::chrono::clock](@ref golxzn::os::chrono::clock)
  * - [golxzn::os::chrono::fast_timer](@ref golxzn::os::chrono::fast_timer)
  * - [golxzn::os::chrono::timer](@ref golxzn::os::chrono::timer)
+ * - [golxzn::os::chrono::deadline](@ref golxzn::os::chrono::basic_deadline)
+ * - [golxzn::os::chrono::timer_service](@ref golxzn::os::chrono::timer_service) - shared timers with lock-free arming and O(1) cancel
+ * - [golxzn::os::chrono::sharded_timer_service](@ref golxzn::os::chrono::sharded_timer_service) - one timer service and driver per core
+ * - [golxzn::os::chrono::backoff](@ref golxzn::os::chrono::backoff) - exponential backoff with full or decorrelated jitter
+ * - [golxzn::os::chrono::retry_scheduler](@ref golxzn::os::chrono::retry_scheduler) - retries with backoff on timers instead of sleeping threads
+ * - [golxzn::os::chrono::watchdog](@ref golxzn::os::chrono::watchdog)
+ * - [golxzn::os::chrono::lateness_histogram](@ref golxzn::os::chrono::lateness_histogram)
+ * - [golxzn::os::chrono::ewma_meter](@ref golxzn::os::chrono::ewma_meter)
+ * - [golxzn::os::chrono::sliding_window_meter](@ref golxzn::os::chrono::sliding_window_meter)
+ * - [golxzn::os::chrono::time_series_ring](@ref golxzn::os::chrono::time_series_ring)
+ * - [golxzn::os::chrono::periodic_scheduler](@ref golxzn::os::chrono::periodic_scheduler)
+ * - [golxzn::os::chrono::bounded_queue](@ref golxzn::os::chrono::bounded_queue) - bounded MPMC queue with timed push and pop
+ * - [golxzn::os::chrono::edf_executor](@ref golxzn::os::chrono::edf_executor) - earliest-deadline-first task executor
+ * - [golxzn::os::chrono::shm_clock](@ref golxzn::os::chrono::shm_clock)
+ * - [golxzn::os::chrono::replay_clock](@ref golxzn::os::chrono::replay_clock) - recording and replaying of clock reads
+ * - [golxzn::os::chrono::check_skew](@ref golxzn::os::chrono::check_skew) - cross-core clock consistency checker
+ * - [golxzn::os::chrono::perf_clock](@ref golxzn::os::chrono::perf_clock)
+ * - [golxzn::os::chrono::manual_clock](@ref golxzn::os::chrono::manual_clock)
+ * - [golxzn::os::chrono::auto_clock](@ref golxzn::os::chrono::auto_clock) - clock which picks the cheapest adequate source at startup
+ * - [golxzn::os::chrono::scaled_clock](@ref golxzn::os::chrono::scaled_clock) - tree of pausable and time-dilated clocks
+ * - [golxzn::os::chrono::profiler](@ref golxzn::os::chrono::profiler) - continuous call-tree profiler
+ * - [golxzn::os::chrono::profiler::sampler](@ref golxzn::os::chrono::profiler::sampler) - sampling profiler on per-thread CPU timers
+ * - [golxzn::os::chrono::openmetrics](@ref golxzn::os::chrono::openmetrics) - OpenMetrics exporter of timing statistics
+ * - [golxzn::os::chrono::bench](@ref golxzn::os::chrono::bench) - statistical micro-benchmark harness
+ * - [golxzn::os::chrono::bulk](@ref golxzn::os::chrono::bulk) - bulk operations over arrays of time
  *
  * Diagram
  * -------------
@@ -76,7 +101,29 @@
 
 #include <golxzn/os/chrono/time.hpp>
 #include <golxzn/os/chrono/clock.hpp>
+#include <golxzn/os/chrono/scaled_clock.hpp>
+#include <golxzn/os/chrono/deadline.hpp>
+#include <golxzn/os/chrono/lateness.hpp>
 #include <golxzn/os/chrono/timer.hpp>
+#include <golxzn/os/chrono/timer_service.hpp>
+#include <golxzn/os/chrono/backoff.hpp>
+#include <golxzn/os/chrono/watchdog.hpp>
+#include <golxzn/os/chrono/meter.hpp>
+#include <golxzn/os/chrono/time_series.hpp>
+#include <golxzn/os/chrono/periodic_scheduler.hpp>
+#include <golxzn/os/chrono/bounded_queue.hpp>
+#include <golxzn/os/chrono/edf_executor.hpp>
+#include <golxzn/os/chrono/bulk.hpp>
+#include <golxzn/os/chrono/manual_clock.hpp>
+#include <golxzn/os/chrono/auto_clock.hpp>
+#include <golxzn/os/chrono/perf.hpp>
+#include <golxzn/os/chrono/shm_clock.hpp>
+#include <golxzn/os/chrono/replay_clock.hpp>
+#include <golxzn/os/chrono/skew.hpp>
+#include <golxzn/os/chrono/bench.hpp>
+#include <golxzn/os/chrono/profiler.hpp>
+#include <golxzn/os/chrono/sampler.hpp>
+#include <golxzn/os/chrono/openmetrics.hpp>
 
 namespace gxzn = golxzn;
 
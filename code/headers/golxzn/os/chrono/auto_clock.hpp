@@ -0,0 +1,112 @@
+/**
+ * @file golxzn/os/chrono/auto_clock.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Monotonic clock which picks the cheapest adequate time source at startup
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string_view>
+
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Monotonic time sources probed by golxzn::os::chrono::auto_clock.
+ * @ingroup Chrono clocks
+ */
+enum class clock_source : u8 {
+	steady,           ///< `std::chrono::steady_clock`. Always available
+	monotonic_raw,    ///< `CLOCK_MONOTONIC_RAW` (Linux). Not slewed by NTP
+	monotonic_coarse, ///< `CLOCK_MONOTONIC_COARSE` (Linux). Cheap, but ticks with the scheduler
+	cycle_counter,    ///< Invariant TSC on x86_64 or the virtual counter on AArch64, calibrated to nanoseconds
+};
+
+/**
+ * @brief Measured properties of a time source.
+ * @ingroup Chrono clocks
+ */
+struct clock_probe {
+	clock_source source{};                  ///< Probed source
+	bool available{};                       ///< False if the source isn't supported on this host
+	std::chrono::nanoseconds resolution{};  ///< Smallest observed step (or the reported one if it's larger)
+	f64 cost{};                             ///< Average cost of a read in nanoseconds
+};
+
+/**
+ * @brief Returns name of the time source.
+ * @ingroup Chrono clocks
+ */
+[[nodiscard]] std::string_view name_of(const clock_source source) noexcept;
+
+/**
+ * @brief Monotonic STL compatible clock which reads the cheapest source meeting the required resolution.
+ * @ingroup Chrono clocks
+ * @details `utils::default_base_clock` is chosen at compile time and knows nothing about the host.
+ * auto_clock probes the available sources (golxzn::os::chrono::clock_source) once: measures their
+ * resolution and read cost, then routes `now()` through a function pointer to the cheapest one which
+ * resolution is enough. Sources aren't switched after that, so time points stay comparable.
+ *
+ * The selection happens on the first `now()` with the microsecond requirement, or explicitly
+ * with `select()` which has to be called before any read. Probing takes a few tens of milliseconds.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::auto_clock::select(std::chrono::microseconds{ 1 }); // optional
+ * golxzn::os::chrono::fast_clock<golxzn::os::chrono::auto_clock> clock;
+ * ...
+ * std::printf("%s took %lld us\n", golxzn::os::chrono::name_of(golxzn::os::chrono::auto_clock::source()).data(),
+ * 	clock.elapsed().microseconds());
+ * @endcode
+ */
+class auto_clock {
+public:
+	using rep = i64;                                        ///< Representation type
+	using period = std::nano;                               ///< Tick period
+	using duration = std::chrono::duration<rep, period>;    ///< Duration type
+	using time_point = std::chrono::time_point<auto_clock>; ///< Time point type
+
+	static constexpr bool is_steady{ true };
+
+	/**
+	 * @brief Probes time sources and selects the cheapest one with at least the required resolution.
+	 * @details Falls back to golxzn::os::chrono::clock_source::steady if no source is fine enough.
+	 * @param resolution Required resolution.
+	 * @return false if the source has already been selected (explicitly or by `now()`).
+	 */
+	static bool select(const std::chrono::nanoseconds resolution = std::chrono::microseconds{ 1 });
+
+	/**
+	 * @brief Returns current time of the selected source.
+	 */
+	[[nodiscard]] static time_point now() noexcept {
+		return time_point{ duration{ s_read.load(std::memory_order_acquire)() } };
+	}
+
+	/**
+	 * @brief Returns the selected source. Selects it if it hasn't been done yet.
+	 */
+	[[nodiscard]] static clock_source source();
+
+	/**
+	 * @brief Returns results of probing. Selects the source if it hasn't been done yet.
+	 */
+	[[nodiscard]] static const std::vector<clock_probe> &probes();
+
+private:
+	using read_function = rep (*)() noexcept;
+
+	/// Points to the selecting function until the source is selected
+	static std::atomic<read_function> s_read;
+
+	static rep select_and_read() noexcept;
+};
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,260 @@
+/**
+ * @file golxzn/os/chrono/backoff.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Exponential backoff with jitter and retry scheduler which waits on timers instead of threads
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <condition_variable>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/deadline.hpp"
+#include "golxzn/os/chrono/timer.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief How random delays of golxzn::os::chrono::backoff are.
+ * @ingroup Chrono backoff
+ */
+enum class backoff_jitter : u8 {
+	none,         ///< Exact exponential delays: initial, initial * multiplier, ...
+	full,         ///< Uniformly random delay between zero and the exponential one
+	decorrelated, ///< Uniformly random delay between initial and the previous delay * multiplier
+};
+
+/**
+ * @brief Parameters of golxzn::os::chrono::backoff.
+ * @ingroup Chrono backoff
+ */
+struct backoff_policy {
+	time initial{ std::chrono::milliseconds{ 100 } }; ///< Delay before the first retry
+	time cap{ std::chrono::seconds{ 30 } };           ///< The longest delay
+	f64 multiplier{ 2.0 };                            ///< Growth of the delay per retry
+	backoff_jitter jitter{ backoff_jitter::full };    ///< Randomization of delays
+	u32 max_retries{};                                ///< Retries before giving up. 0 means unlimited
+};
+
+/**
+ * @brief Sequence of delays between retries of one operation.
+ * @ingroup Chrono backoff
+ * @details Without jitter, clients which failed together retry together and hit the recovering service
+ * with synchronized storms. Full jitter spreads retries over the whole exponential window;
+ * decorrelated jitter grows from the previous random delay, so it rarely returns very short ones.
+ * Every instance has its own generator, so it's cheap to copy and isn't thread-safe.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::backoff delays{ { golxzn::os::chrono::milliseconds(50) } };
+ * while (!connect() && !delays.exhausted()) {
+ * 	std::this_thread::sleep_for(delays.next().duration()); // or golxzn::os::chrono::retry_scheduler
+ * }
+ * @endcode
+ */
+class backoff {
+public:
+	/**
+	 * @brief Constructs backoff.
+	 * @param policy Parameters of the delays.
+	 * @param seed Seed of the generator. 0 picks a unique one.
+	 */
+	explicit backoff(const backoff_policy &policy = {}, const u64 seed = 0) noexcept;
+
+	/**
+	 * @brief Returns delay before the next retry and counts the retry.
+	 */
+	[[nodiscard]] time next() noexcept;
+
+	/**
+	 * @brief Starts the sequence over, e.g. after a success.
+	 */
+	void reset() noexcept;
+
+	/**
+	 * @brief Returns number of `next()` calls since construction or `reset()`.
+	 */
+	[[nodiscard]] u32 retries() const noexcept;
+
+	/**
+	 * @brief Returns true if `max_retries` of the policy are used up.
+	 */
+	[[nodiscard]] bool exhausted() const noexcept;
+
+	/**
+	 * @brief Returns parameters of the delays.
+	 */
+	[[nodiscard]] const backoff_policy &policy() const noexcept;
+
+private:
+	backoff_policy m_policy;
+	u64 m_state;
+	f64 m_window{};   ///< Exponential delay of the next retry in microseconds
+	f64 m_previous{}; ///< The previous delay in microseconds (decorrelated jitter)
+	u32 m_retries{};
+
+	[[nodiscard]] f64 uniform(const f64 from, const f64 to) noexcept;
+};
+
+#if defined(GOLXZN_MULTITHREADING)
+
+/**
+ * @brief How golxzn::os::chrono::retry_scheduler has finished the operation. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono backoff
+ */
+enum class retry_outcome : u8 {
+	succeeded, ///< An attempt has succeeded
+	exhausted, ///< The last allowed attempt has failed
+	expired,   ///< The next attempt wouldn't start before the deadline
+	cancelled, ///< Cancelled by `cancel()` or the scheduler destruction
+	rejected,  ///< The timer service had no free slot for the next attempt
+};
+
+/**
+ * @brief Statistics of golxzn::os::chrono::retry_scheduler. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono backoff
+ */
+struct retry_stats {
+	u64 submitted{}; ///< Submitted operations
+	u64 attempts{};  ///< Attempts of all operations
+	u64 succeeded{}; ///< Operations finished with retry_outcome::succeeded
+	u64 exhausted{}; ///< Operations finished with retry_outcome::exhausted
+	u64 expired{};   ///< Operations finished with retry_outcome::expired
+	u64 cancelled{}; ///< Operations finished with retry_outcome::cancelled
+	u64 rejected{};  ///< Operations finished with retry_outcome::rejected
+};
+
+/**
+ * @brief Retries operations with backoff delays without blocking any thread. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono backoff
+ * @details Every attempt is a timer of golxzn::os::chrono::sharded_timer_service: the first one fires
+ * right away, every failed one arms the next after `backoff::next()`. Waiting operations cost a timer
+ * slot each, so thousands of them don't need a thread. An operation finishes when an attempt succeeds,
+ * retries are used up, the next attempt would start after the deadline, or it's cancelled; then the
+ * completion is called with the outcome and the number of attempts.
+ *
+ * Attempts and completions are called by timer drivers, so they have to be short and non-blocking:
+ * start an asynchronous request or try a non-blocking call. Attempts of one operation never overlap.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::retry_scheduler<> retries;
+ *
+ * retries.submit([&client] { return client.try_reconnect(); },
+ * 	[](const golxzn::os::chrono::retry_outcome outcome, const golxzn::u32 attempts) { report(outcome, attempts); },
+ * 	golxzn::os::chrono::backoff_policy{ golxzn::os::chrono::milliseconds(100) },
+ * 	golxzn::os::chrono::deadline::after(std::chrono::minutes{ 1 }));
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic, STL compatible
+ * and have static `now()`.
+ */
+template<class BaseClock = utils::default_base_clock>
+class retry_scheduler {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::retry_scheduler] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::retry_scheduler] BaseClock's resolution is less than microseconds!");
+	static_assert(utils::has_static_now_v<BaseClock>,
+		"[golxzn::os::chrono::retry_scheduler] Timer drivers require BaseClock with static now()");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+	using deadline_type = basic_deadline<BaseClock>;    ///< Deadline type
+	using service_type = sharded_timer_service<BaseClock>; ///< Timer service type
+	using attempt = std::function<bool()>;              ///< Attempt of the operation. Returns true on success
+	using completion = std::function<void(const retry_outcome, const u32)>; ///< Receives outcome and number of attempts
+
+	static constexpr u64 invalid_id{}; ///< Never returned by `submit()`
+
+	/**
+	 * @brief Constructs scheduler on the process-wide service which drives golxzn::os::chrono::timer.
+	 */
+	retry_scheduler();
+
+	/**
+	 * @brief Constructs scheduler on the given timer service.
+	 * @warning The service has to outlive this scheduler.
+	 */
+	explicit retry_scheduler(service_type &timers);
+
+	retry_scheduler(const retry_scheduler &) = delete;
+	retry_scheduler &operator=(const retry_scheduler &) = delete;
+
+	/**
+	 * @brief Cancels all operations and waits until running attempts and completions return.
+	 */
+	~retry_scheduler();
+
+	/**
+	 * @brief Submits operation. Could be called from any thread.
+	 * @param task Attempt of the operation.
+	 * @param done Completion of the operation. Could be called before this function returns.
+	 * @param policy Delays between attempts.
+	 * @param deadline No attempt starts after it.
+	 * @return Identifier of the operation.
+	 */
+	u64 submit(attempt &&task, completion &&done = {}, const backoff_policy &policy = {},
+		const deadline_type deadline = deadline_type::never());
+
+	/**
+	 * @brief Cancels operation. Could be called from any thread.
+	 * @details The running attempt isn't interrupted. If it succeeds, the operation is succeeded.
+	 * @return true if no more attempts will start. false if the operation has finished or was cancelled.
+	 */
+	bool cancel(const u64 id);
+
+	/**
+	 * @brief Returns number of unfinished operations.
+	 */
+	[[nodiscard]] std::size_t active() const;
+
+	/**
+	 * @brief Returns statistics since construction.
+	 */
+	[[nodiscard]] retry_stats stats() const;
+
+private:
+	struct operation {
+		u64 id;
+		attempt task;
+		completion done;
+		backoff delays;
+		deadline_type deadline;
+		timer_handle timer{};
+		u32 attempts{};
+		bool cancelled{};
+	};
+
+	service_type &m_timers;
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_finished;
+	std::unordered_map<u64, std::unique_ptr<operation>> m_operations;
+	u64 m_next_id{ invalid_id + 1 };
+	bool m_stopping{};
+	retry_stats m_stats;
+
+	[[nodiscard]] bool schedule(operation &target, const time delay, retry_outcome &outcome);
+	void run(operation &target);
+	void finish(operation &target, const retry_outcome outcome);
+};
+
+#include "golxzn/os/chrono/impl/backoff.inl"
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono
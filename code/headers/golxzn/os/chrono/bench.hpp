@@ -0,0 +1,132 @@
+/**
+ * @file golxzn/os/chrono/bench.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Statistical micro-benchmark harness built on the library's clocks
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono::bench {
+
+/**
+ * @brief Benchmark options.
+ * @ingroup Chrono bench
+ */
+struct options {
+	time warmup{ std::chrono::milliseconds{ 100 } };       ///< Time to run callable before measurement
+	time sample_target{ std::chrono::milliseconds{ 1 } };  ///< Minimal duration of one sample. Iterations are scaled to reach it
+	std::size_t samples{ 100 };                            ///< Number of samples
+	std::size_t max_iterations{ std::size_t{ 1 } << 30 };  ///< Upper limit of iterations per sample
+	std::size_t resamples{ 1000 };                         ///< Number of bootstrap resamples
+	f64 confidence{ 0.95 };                                ///< Confidence level of intervals
+	f64 outlier_threshold{ 3.5 };                          ///< Modified z-score above which sample is an outlier
+	u64 seed{ 0x5EEDu };                                   ///< Bootstrap random seed
+};
+
+/**
+ * @brief Point estimate with bootstrap confidence interval.
+ * @ingroup Chrono bench
+ * @details Values are nanoseconds per iteration. Use value() to get time.
+ */
+struct estimate {
+	f64 point{}; ///< Point estimate in nanoseconds
+	f64 lower{}; ///< Lower bound of the confidence interval in nanoseconds
+	f64 upper{}; ///< Upper bound of the confidence interval in nanoseconds
+
+	/**
+	 * @brief Returns point estimate as time.
+	 * @warning time has microseconds resolution, so very fast callables are rounded to zero.
+	 */
+	[[nodiscard]] time value() const noexcept;
+};
+
+/**
+ * @brief Benchmark result. All estimates are per single iteration.
+ * @ingroup Chrono bench
+ */
+struct result {
+	estimate mean;            ///< Mean
+	estimate median;          ///< Median
+	estimate mad;             ///< Median absolute deviation
+	f64 overhead{};           ///< Clock read overhead subtracted from every sample, nanoseconds
+	time total{};             ///< Total measured time including outliers
+	std::size_t iterations{}; ///< Iterations per sample
+	std::size_t samples{};    ///< Samples used for statistics
+	std::size_t outliers{};   ///< Rejected samples
+};
+
+/**
+ * @brief Makes compiler think that value is used.
+ * @ingroup Chrono bench
+ * @details Results of benchmarked callables are passed here automatically.
+ */
+template<class T>
+void do_not_optimize(T &&value) noexcept;
+
+/**
+ * @brief Runs callable and computes statistics of its execution time.
+ * @ingroup Chrono bench
+ * @details Steps:
+ * 1. Measures clock read overhead;
+ * 2. Runs callable for `options::warmup`;
+ * 3. Doubles iteration count until a sample takes at least `options::sample_target`;
+ * 4. Collects `options::samples` samples subtracting clock overhead from each;
+ * 5. Rejects outliers using modified z-score based on MAD;
+ * 6. Computes mean, median and MAD with bootstrap confidence intervals.
+ *
+ * Usage:
+ * @code{.cpp}
+ * const auto stats{ golxzn::os::chrono::bench::run([&] { return hash(payload); }) };
+ * std::cout << golxzn::os::chrono::bench::to_json(stats, "hash") << '\n';
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic.
+ * @param callable Function to benchmark. Its result is passed to do_not_optimize.
+ * @param opts Benchmark options.
+ */
+template<class BaseClock = utils::default_base_clock, class Callable>
+[[nodiscard]] result run(Callable &&callable, const options &opts = {});
+
+/**
+ * @brief Runs callable and computes statistics of its execution time using base clock instance.
+ * @ingroup Chrono bench
+ * @details Required for stateful base clocks.
+ * @see run(Callable &&callable, const options &opts)
+ */
+template<class BaseClock, class Callable, class = typename BaseClock::time_point>
+[[nodiscard]] result run(BaseClock &base, Callable &&callable, const options &opts = {});
+
+/**
+ * @brief Computes statistics from raw samples.
+ * @ingroup Chrono bench
+ * @param samples Duration of each sample in nanoseconds with clock overhead already subtracted.
+ * @param iterations Iterations per sample.
+ * @param overhead Subtracted clock overhead in nanoseconds.
+ * @param opts Benchmark options.
+ */
+[[nodiscard]] result analyze(std::vector<f64> samples, const std::size_t iterations, const f64 overhead,
+	const options &opts = {});
+
+/**
+ * @brief Serializes result to JSON object.
+ * @ingroup Chrono bench
+ * @param stats Benchmark result.
+ * @param name Benchmark name. Omitted if empty.
+ */
+[[nodiscard]] std::string to_json(const result &stats, const std::string_view name = {});
+
+#include "golxzn/os/chrono/impl/bench.inl"
+
+} // namespace golxzn::os::chrono::bench
@@ -0,0 +1,208 @@
+/**
+ * @file golxzn/os/chrono/bounded_queue.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Bounded lock-free MPMC queue with deadline-aware push and pop
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <new>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <atomic>
+#if !defined(GXZN_CHRONO_LINUX)
+#include <mutex>
+#include <condition_variable>
+#endif // !defined(GXZN_CHRONO_LINUX)
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/deadline.hpp"
+
+namespace golxzn::os::chrono {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+namespace details {
+
+/**
+ * @brief Place where threads sleep until they're notified or the timeout passes.
+ * @details It's a futex on Linux and a mutex with condition variable elsewhere. Notifications are free
+ * while nobody waits. A waiter calls `prepare()`, rechecks its condition, then calls `wait()` with
+ * the returned epoch and `finish()` after it.
+ */
+class alignas(64) wait_point {
+public:
+	[[nodiscard]] u32 prepare() noexcept;
+	void wait(const u32 epoch, const std::chrono::nanoseconds timeout) noexcept;
+	void finish() noexcept;
+
+	void notify_one() noexcept;
+	void notify_all() noexcept;
+
+private:
+	std::atomic<u32> m_epoch{};
+	std::atomic<u32> m_waiters{};
+#if !defined(GXZN_CHRONO_LINUX)
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+#endif // !defined(GXZN_CHRONO_LINUX)
+
+	void notify(const bool all) noexcept;
+};
+
+} // namespace details
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue with timed push and pop.
+ * @ingroup Chrono queue
+ * @details Ring of cells with sequence numbers: `try_push()` and `try_pop()` claim a position with one
+ * CAS and never block. Timed operations spin for a while, then park on golxzn::os::chrono::details::wait_point
+ * until the opposite side notifies them or the deadline passes, so timeouts don't need timer objects or
+ * polling. Notifying costs one atomic load while nobody waits.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::bounded_queue<job> jobs{ 1024 };
+ *
+ * // consumer
+ * job next;
+ * while (jobs.try_pop_for(next, 100ms)) {
+ * 	next.run();
+ * }
+ *
+ * // producer
+ * if (!jobs.try_push_until(std::move(request), request_deadline)) {
+ * 	reject(request);
+ * }
+ * @endcode
+ * @tparam T Element type. It has to be nothrow movable.
+ */
+template<class T>
+class bounded_queue {
+	static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+		"[golxzn::os::chrono::bounded_queue] T has to be nothrow movable");
+
+public:
+	using value_type = T; ///< Element type
+
+	static constexpr u32 spin_count{ 128 }; ///< Attempts before timed operations park
+
+	/**
+	 * @brief Constructs queue.
+	 * @param capacity Maximum number of elements. It's rounded up to the power of two, at least two.
+	 */
+	explicit bounded_queue(const std::size_t capacity);
+
+	bounded_queue(const bounded_queue &) = delete;
+	bounded_queue &operator=(const bounded_queue &) = delete;
+	~bounded_queue();
+
+	/**
+	 * @brief Pushes value if there's room.
+	 * @details If T could throw while being constructed from the value, the value is converted to T
+	 * before a cell is claimed, so an rvalue is moved from even if the push fails.
+	 * @return false if the queue is full. The value isn't moved then, unless it had to be converted.
+	 */
+	template<class U>
+	bool try_push(U &&value);
+
+	/**
+	 * @brief Pushes value waiting for room until the deadline.
+	 * @details A value which has to be converted by a throwing constructor is converted once, and
+	 * every retry pushes that object.
+	 * @return false if the queue is still full at the deadline. The value isn't moved then, unless
+	 * it had to be converted (see try_push()).
+	 */
+	template<class U, class BaseClock>
+	bool try_push_until(U &&value, const basic_deadline<BaseClock> &deadline);
+
+	/**
+	 * @brief Pushes value waiting for room no longer than timeout.
+	 * @see try_push_until
+	 */
+	template<class U>
+	bool try_push_for(U &&value, const time timeout);
+
+	/**
+	 * @brief Pushes value waiting for room no longer than timeout.
+	 * @see try_push_until
+	 */
+	template<class U, class Rep, class Period>
+	bool try_push_for(U &&value, const std::chrono::duration<Rep, Period> timeout);
+
+	/**
+	 * @brief Pops value if there's any.
+	 * @return false if the queue is empty.
+	 */
+	bool try_pop(T &value) noexcept;
+
+	/**
+	 * @brief Pops value waiting for it until the deadline.
+	 * @return false if the queue is still empty at the deadline.
+	 */
+	template<class BaseClock>
+	bool try_pop_until(T &value, const basic_deadline<BaseClock> &deadline);
+
+	/**
+	 * @brief Pops value waiting for it no longer than timeout.
+	 * @see try_pop_until
+	 */
+	bool try_pop_for(T &value, const time timeout);
+
+	/**
+	 * @brief Pops value waiting for it no longer than timeout.
+	 * @see try_pop_until
+	 */
+	template<class Rep, class Period>
+	bool try_pop_for(T &value, const std::chrono::duration<Rep, Period> timeout);
+
+	/**
+	 * @brief Returns maximum number of elements.
+	 */
+	[[nodiscard]] std::size_t capacity() const noexcept;
+
+	/**
+	 * @brief Returns number of elements. It's approximate while other threads push or pop.
+	 */
+	[[nodiscard]] std::size_t size() const noexcept;
+
+	/**
+	 * @brief Returns true if there are no elements. It's approximate while other threads push or pop.
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+private:
+	struct alignas(64) cell {
+		std::atomic<std::size_t> sequence;
+		alignas(T) unsigned char storage[sizeof(T)];
+	};
+
+	const std::size_t m_mask;
+	const std::unique_ptr<cell[]> m_cells;
+	alignas(64) std::atomic<std::size_t> m_tail{};
+	alignas(64) std::atomic<std::size_t> m_head{};
+	details::wait_point m_readable;
+	details::wait_point m_writable;
+
+	[[nodiscard]] bool full() const noexcept;
+
+	template<class BaseClock>
+	[[nodiscard]] static std::chrono::nanoseconds timeout_of(const basic_deadline<BaseClock> &deadline,
+		const typename BaseClock::time_point now) noexcept;
+};
+
+#include "golxzn/os/chrono/impl/bounded_queue.inl"
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,147 @@
+/**
+ * @file golxzn/os/chrono/bulk.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Bulk conversions and arithmetic over contiguous arrays of time
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono::bulk {
+
+/**
+ * @brief Converts each value to seconds.
+ * @ingroup Chrono bulk
+ * @details Produces the same results as calling `time::seconds<f32>()` for every element.
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param out Output array. It has to have at least `count` elements.
+ */
+void to_seconds(const time *values, const std::size_t count, f32 *out) noexcept;
+
+/**
+ * @brief Converts each value to seconds.
+ * @ingroup Chrono bulk
+ * @details Produces the same results as calling `time::seconds<f64>()` for every element.
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param out Output array. It has to have at least `count` elements.
+ */
+void to_seconds(const time *values, const std::size_t count, f64 *out) noexcept;
+
+/**
+ * @brief Converts each value to milliseconds.
+ * @ingroup Chrono bulk
+ * @details Produces the same results as calling `time::milliseconds()` for every element.
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param out Output array. It has to have at least `count` elements.
+ */
+void to_milliseconds(const time *values, const std::size_t count, i32 *out) noexcept;
+
+/**
+ * @brief Converts each value to microseconds.
+ * @ingroup Chrono bulk
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param out Output array. It has to have at least `count` elements.
+ */
+void to_microseconds(const time *values, const std::size_t count, i64 *out) noexcept;
+
+/**
+ * @brief Adds offset to each value in place.
+ * @ingroup Chrono bulk
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param offset Offset to add.
+ */
+void add(time *values, const std::size_t count, const time offset) noexcept;
+
+/**
+ * @brief Subtracts offset from each value in place.
+ * @ingroup Chrono bulk
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param offset Offset to subtract.
+ */
+void subtract(time *values, const std::size_t count, const time offset) noexcept;
+
+/**
+ * @brief Clamps each value into [low, high] in place.
+ * @ingroup Chrono bulk
+ * @warning `low` has to be less or equal to `high`.
+ * @param values Pointer to the first time value.
+ * @param count Number of values.
+ * @param low Lower bound.
+ * @param high Upper bound.
+ */
+void clamp(time *values, const std::size_t count, const time low, const time high) noexcept;
+
+/**
+ * @brief Returns the smallest value or time::zero() if there're no values.
+ * @ingroup Chrono bulk
+ */
+[[nodiscard]] time min(const time *values, const std::size_t count) noexcept;
+
+/**
+ * @brief Returns the largest value or time::zero() if there're no values.
+ * @ingroup Chrono bulk
+ */
+[[nodiscard]] time max(const time *values, const std::size_t count) noexcept;
+
+/**
+ * @brief Returns the sum of all values.
+ * @ingroup Chrono bulk
+ */
+[[nodiscard]] time sum(const time *values, const std::size_t count) noexcept;
+
+/**
+ * @brief Returns true if bulk operations use explicit SIMD kernels on this machine.
+ * @ingroup Chrono bulk
+ * @details Otherwise they fall back to scalar loops.
+ */
+[[nodiscard]] bool accelerated() noexcept;
+
+
+/**
+ * @brief Container overloads of the bulk operations.
+ * @ingroup Chrono bulk
+ * @details Accept any contiguous container of time (`std::vector`, `std::array`, `std::span`, etc.).
+ *
+ * Usage:
+ * @code{.cpp}
+ * std::vector<golxzn::os::chrono::time> samples{ ... };
+ * std::vector<float> seconds(samples.size());
+ * golxzn::os::chrono::bulk::to_seconds(samples, seconds);
+ * @endcode
+ */
+template<class Container, class Output>
+void to_seconds(const Container &values, Output &&out) noexcept;
+template<class Container, class Output>
+void to_milliseconds(const Container &values, Output &&out) noexcept;
+template<class Container, class Output>
+void to_microseconds(const Container &values, Output &&out) noexcept;
+template<class Container>
+void add(Container &&values, const time offset) noexcept;
+template<class Container>
+void subtract(Container &&values, const time offset) noexcept;
+template<class Container>
+void clamp(Container &&values, const time low, const time high) noexcept;
+template<class Container>
+[[nodiscard]] time min(const Container &values) noexcept;
+template<class Container>
+[[nodiscard]] time max(const Container &values) noexcept;
+template<class Container>
+[[nodiscard]] time sum(const Container &values) noexcept;
+
+#include "golxzn/os/chrono/impl/bulk.inl"
+
+} // namespace golxzn::os::chrono::bulk
@@ -23,6 +23,7 @@ namespace golxzn::os::chrono {
  * > It doesn't store any information but last time point. When you call elapsed(), it stores new time point,
  * > and returns difference of old and new time points.
  * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ * If it doesn't have static `now()`, the clock instance has to be passed to the constructor.
  *
  * Usage:
  * @code{.cpp}
@@ -36,7 +37,7 @@ namespace golxzn::os::chrono {
  * @see golxzn::os::chrono::clock
  */
 template<class BaseClock = utils::default_base_clock>
-class fast_clock {
+class fast_clock : private utils::base_clock_ref<BaseClock> {
 	static_assert(BaseClock::is_steady,
 		"[golxzn::os::chrono::fast_clock] BaseClock is not a monotonic clock");
 	static_assert(utils::enough_resolution_v<BaseClock>,
@@ -47,6 +48,16 @@ public:
 	using time_point = typename base_clock::time_point; ///< Time point type from base clock
 	static constexpr time_point zero{};                 ///< Zero time point
 
+	fast_clock() noexcept = default;
+
+	/**
+	 * @brief Constructs clock which measures time of the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this clock.
+	 * @param base base clock instance
+	 */
+	explicit fast_clock(base_clock &base) noexcept;
+
 	/**
 	 * @brief Returns elapsed time since last call of `elapsed()` or since construction.
 	 * @return time
@@ -54,7 +65,9 @@ public:
 	[[nodiscard]] time elapsed() noexcept;
 
 private:
-	time_point m_last_time{ base_clock::now() };
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	time_point m_last_time{ clock_ref::now() };
 };
 
 /**
@@ -62,10 +75,11 @@ private:
  * @ingroup Chrono clocks
  * In comparison with @ref golxzn::os::chrono::fast_clock, it provides more functionality but it's slower.
  * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ * If it doesn't have static `now()`, the clock instance has to be passed to the constructor.
  * @see golxzn::os::chrono::fast_clock
  */
 template<class BaseClock = utils::default_base_clock>
-class clock {
+class clock : private utils::base_clock_ref<BaseClock> {
 	static_assert(BaseClock::is_steady,
 		"[golxzn::os::chrono::clock] BaseClock is not a monotonic clock");
 	static_assert(utils::enough_resolution_v<BaseClock>,
@@ -76,6 +90,16 @@ public:
 	using time_point = typename base_clock::time_point;
 	static constexpr time_point zero{};
 
+	clock() noexcept = default;
+
+	/**
+	 * @brief Constructs clock which measures time of the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this clock.
+	 * @param base base clock instance
+	 */
+	explicit clock(base_clock &base) noexcept;
+
 	/**
 	 * @brief Returns true if clock is running.
 	 * @return clock running state
@@ -131,7 +155,9 @@ public:
 	void stop() noexcept;
 
 private:
-	time_point m_last_reset_time{ base_clock::now() };
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	time_point m_last_reset_time{ clock_ref::now() };
 	time_point m_stop_time{ zero };
 };
 
@@ -0,0 +1,163 @@
+/**
+ * @file golxzn/os/chrono/deadline.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Compact absolute deadline value type
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Absolute point in time after which an operation is late.
+ * @ingroup Chrono deadline
+ * @details It stores only one time point of the base clock (8 bytes for STL clocks) and it's trivially copyable,
+ * so it could be densely stored in arrays and used with `std::atomic`. Default constructed deadline is never().
+ * Nested deadlines are composed with min(): the tighter one wins.
+ *
+ * Usage:
+ * @code{.cpp}
+ * void handle(request &req, const golxzn::os::chrono::deadline caller) {
+ * 	const auto limit{ min(caller, golxzn::os::chrono::deadline::after(golxzn::os::chrono::milliseconds(50))) };
+ * 	while (!limit.expired()) {
+ * 		// ...
+ * 	}
+ * }
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ * @see golxzn::os::chrono::fast_timer
+ */
+template<class BaseClock = utils::default_base_clock>
+class basic_deadline {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::basic_deadline] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::basic_deadline] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+
+	/**
+	 * @brief Constructs deadline which never expires.
+	 * @see never()
+	 */
+	constexpr basic_deadline() noexcept = default;
+
+	/**
+	 * @brief Constructs deadline at the time point.
+	 * @ingroup Chrono deadline construction
+	 * @param point Absolute time point.
+	 */
+	explicit constexpr basic_deadline(const time_point point) noexcept;
+
+	/**
+	 * @brief Makes deadline which expires after interval since now.
+	 * @ingroup Chrono deadline construction
+	 * @param interval Interval since now. Negative interval makes already expired deadline.
+	 */
+	[[nodiscard]] static basic_deadline after(const time interval) noexcept;
+
+	/**
+	 * @brief Makes deadline which expires after interval since now.
+	 * @ingroup Chrono deadline construction
+	 * @param interval Interval since now.
+	 */
+	template<class Rep, class Period>
+	[[nodiscard]] static basic_deadline after(const std::chrono::duration<Rep, Period> interval) noexcept;
+
+	/**
+	 * @brief Makes deadline which expires after interval since now of the base clock instance.
+	 * @ingroup Chrono deadline construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @param base Base clock instance.
+	 * @param interval Interval since now.
+	 */
+	[[nodiscard]] static basic_deadline after(const base_clock &base, const time interval) noexcept;
+
+	/**
+	 * @brief Makes deadline which never expires.
+	 * @ingroup Chrono deadline construction
+	 */
+	[[nodiscard]] static constexpr basic_deadline never() noexcept;
+
+	/**
+	 * @brief Returns absolute time point of the deadline.
+	 */
+	[[nodiscard]] constexpr time_point point() const noexcept;
+
+	/**
+	 * @brief Returns true if deadline never expires.
+	 */
+	[[nodiscard]] constexpr bool is_never() const noexcept;
+
+	/**
+	 * @brief Returns true if deadline is reached. Requires base clock with static `now()`.
+	 * @see expired(const time_point now) const noexcept
+	 */
+	[[nodiscard]] bool expired() const noexcept;
+
+	/**
+	 * @brief Returns true if deadline is reached at the given time point.
+	 * @param now Current time point.
+	 */
+	[[nodiscard]] constexpr bool expired(const time_point now) const noexcept;
+
+	/**
+	 * @brief Returns time left to the deadline or zero if it's expired. Requires base clock with static `now()`.
+	 * @see remaining(const time_point now) const noexcept
+	 */
+	[[nodiscard]] time remaining() const noexcept;
+
+	/**
+	 * @brief Returns time left to the deadline since the given time point or zero if it's expired.
+	 * @param now Current time point.
+	 */
+	[[nodiscard]] constexpr time remaining(const time_point now) const noexcept;
+
+	[[nodiscard]] constexpr bool operator==(const basic_deadline &rhs) const noexcept;
+	[[nodiscard]] constexpr bool operator!=(const basic_deadline &rhs) const noexcept;
+	[[nodiscard]] constexpr bool operator>=(const basic_deadline &rhs) const noexcept;
+	[[nodiscard]] constexpr bool operator<=(const basic_deadline &rhs) const noexcept;
+	[[nodiscard]] constexpr bool operator> (const basic_deadline &rhs) const noexcept;
+	[[nodiscard]] constexpr bool operator< (const basic_deadline &rhs) const noexcept;
+
+private:
+	time_point m_point{ time_point::max() };
+};
+
+/**
+ * @brief Deadline of the default base clock.
+ * @ingroup Chrono deadline
+ */
+using deadline = basic_deadline<>;
+
+/**
+ * @brief Returns the tighter (earliest) of two deadlines.
+ * @ingroup Chrono deadline
+ */
+template<class BaseClock>
+[[nodiscard]] constexpr basic_deadline<BaseClock> min(const basic_deadline<BaseClock> &lhs,
+	const basic_deadline<BaseClock> &rhs) noexcept;
+
+/**
+ * @brief Atomically replaces stored deadline with candidate if candidate is tighter.
+ * @ingroup Chrono deadline
+ * @param target Shared deadline.
+ * @param candidate New deadline.
+ * @return true if target was tightened.
+ */
+template<class BaseClock>
+bool tighten(std::atomic<basic_deadline<BaseClock>> &target, const basic_deadline<BaseClock> candidate) noexcept;
+
+#include "golxzn/os/chrono/impl/deadline.inl"
+
+} // namespace golxzn::os::chrono
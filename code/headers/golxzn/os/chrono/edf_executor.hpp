@@ -0,0 +1,223 @@
+/**
+ * @file golxzn/os/chrono/edf_executor.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Earliest-deadline-first task executor
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <functional>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <condition_variable>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/deadline.hpp"
+
+namespace golxzn::os::chrono {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+/**
+ * @brief What golxzn::os::chrono::edf_executor does with tasks which deadline passed before they started.
+ * @ingroup Chrono edf_executor
+ */
+enum class expired_policy : u8 {
+	run,  ///< Run them anyway. They're counted as late starts.
+	drop, ///< Don't run them. Their expired handler is called instead.
+};
+
+/**
+ * @brief Statistics of golxzn::os::chrono::edf_executor. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono edf_executor
+ */
+struct edf_stats {
+	u64 submitted{};   ///< Accepted tasks
+	u64 executed{};    ///< Tasks which were run
+	u64 dropped{};     ///< Tasks which expired before start and weren't run
+	u64 late_starts{}; ///< Tasks which were run after their deadline
+	u64 missed{};      ///< Run tasks which finished after their deadline
+	u64 stolen{};      ///< Tasks taken from heaps of other workers
+
+	/**
+	 * @brief Returns share of finished tasks (run or dropped) which missed their deadline.
+	 */
+	[[nodiscard]] constexpr f64 miss_rate() const noexcept {
+		const auto finished{ executed + dropped };
+		return finished != 0 ? static_cast<f64>(missed + dropped) / static_cast<f64>(finished) : 0.0;
+	}
+};
+
+/**
+ * @brief Thread pool which always runs the most urgent task. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono edf_executor
+ * @details Every worker owns a binary heap of tasks ordered by deadline (ties in submission order) and
+ * publishes its earliest deadline with an atomic. A free worker compares the published deadlines and
+ * takes the earliest task, from its own heap or stolen from another one, so the executor approximates
+ * global EDF while every heap has its own lock. Tasks submitted from a worker go to its own heap, others
+ * are spread round-robin.
+ *
+ * Tasks which deadline passed before they started are run or dropped according to golxzn::os::chrono::expired_policy.
+ * `stats()` reports the deadline miss rate. All timing uses BaseClock.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::edf_executor<> executor{ 4, golxzn::os::chrono::expired_policy::drop };
+ * executor.submit([] { render_frame(); }, golxzn::os::chrono::milliseconds(16));
+ * executor.submit([] { compact_logs(); }, golxzn::os::chrono::time{ 10s });
+ * ...
+ * std::printf("miss rate: %.3f\n", executor.stats().miss_rate());
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class edf_executor : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::edf_executor] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::edf_executor] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+	using deadline_type = basic_deadline<BaseClock>;    ///< Deadline type
+	using task = std::function<void()>;                 ///< Task type
+	using expired_handler = std::function<void(time lateness)>; ///< Called instead of dropped task
+
+	/**
+	 * @brief Starts workers.
+	 * @param workers Number of worker threads. Zero means the number of hardware threads.
+	 * @param policy What to do with tasks which expired before start.
+	 */
+	explicit edf_executor(const std::size_t workers = 0, const expired_policy policy = expired_policy::run);
+
+	/**
+	 * @brief Starts workers which use the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this executor.
+	 */
+	edf_executor(base_clock &base, const std::size_t workers = 0, const expired_policy policy = expired_policy::run);
+
+	edf_executor(const edf_executor &) = delete;
+	edf_executor &operator=(const edf_executor &) = delete;
+
+	/**
+	 * @brief Finishes queued tasks and joins workers.
+	 */
+	~edf_executor();
+
+	/**
+	 * @brief Submits task with the absolute deadline.
+	 * @param callback Task.
+	 * @param deadline Deadline of the task.
+	 * @param on_expired Function called instead of the task if it's dropped.
+	 * @return false if the executor is stopped.
+	 */
+	bool submit(task &&callback, const deadline_type deadline, expired_handler &&on_expired = {});
+
+	/**
+	 * @brief Submits task which has to be done within the budget since now.
+	 * @see submit(task &&callback, const deadline_type deadline, expired_handler &&on_expired)
+	 */
+	bool submit(task &&callback, const time budget, expired_handler &&on_expired = {});
+
+	/**
+	 * @brief Submits task which has to be done within the budget since now.
+	 * @see submit(task &&callback, const deadline_type deadline, expired_handler &&on_expired)
+	 */
+	template<class Rep, class Period>
+	bool submit(task &&callback, const std::chrono::duration<Rep, Period> budget, expired_handler &&on_expired = {});
+
+	/**
+	 * @brief Finishes queued tasks and joins workers. Further submissions are rejected.
+	 */
+	void stop();
+
+	/**
+	 * @brief Returns statistics since construction.
+	 */
+	[[nodiscard]] edf_stats stats() const noexcept;
+
+	/**
+	 * @brief Returns number of queued tasks which haven't started yet.
+	 */
+	[[nodiscard]] std::size_t pending() const noexcept;
+
+	/**
+	 * @brief Returns number of worker threads.
+	 */
+	[[nodiscard]] std::size_t workers() const noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+	using rep = typename time_point::rep;
+
+	struct entry {
+		deadline_type deadline;
+		u64 sequence{};
+		task callback;
+		expired_handler on_expired;
+	};
+
+	struct alignas(64) worker_heap {
+		std::mutex mutex;
+		std::vector<entry> heap;
+		std::atomic<std::size_t> size{};
+		std::atomic<rep> earliest{ std::numeric_limits<rep>::max() };
+	};
+
+	struct alignas(64) counter {
+		std::atomic<u64> value{};
+	};
+
+	struct worker_slot {
+		const void *owner{};
+		std::size_t index{};
+	};
+
+	const expired_policy m_policy;
+	std::vector<std::unique_ptr<worker_heap>> m_heaps;
+	std::vector<std::thread> m_threads;
+
+	std::mutex m_mutex;
+	std::condition_variable m_wakeup;
+	bool m_running{ true };
+	std::atomic<std::size_t> m_pending{};
+	std::atomic<u64> m_sequence{};
+	std::atomic<std::size_t> m_next_heap{};
+
+	counter m_submitted;
+	counter m_executed;
+	counter m_dropped;
+	counter m_late_starts;
+	counter m_missed;
+	counter m_stolen;
+
+	void launch(const std::size_t workers);
+	void work(const std::size_t index);
+	bool take(const std::size_t index, entry &target);
+	void run(entry &target);
+
+	/// Heap comparator: true if lhs is less urgent, so the most urgent entry is on top
+	[[nodiscard]] static bool later(const entry &lhs, const entry &rhs) noexcept;
+	static void publish(worker_heap &target) noexcept;
+	[[nodiscard]] static worker_slot &current_worker() noexcept;
+};
+
+#include "golxzn/os/chrono/impl/edf_executor.inl"
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono
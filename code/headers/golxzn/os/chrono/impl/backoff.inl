@@ -0,0 +1,151 @@
+
+template<class Base>
+retry_scheduler<Base>::retry_scheduler()
+	: m_timers{ details::shared_timer_service<Base>() } {
+}
+
+template<class Base>
+retry_scheduler<Base>::retry_scheduler(service_type &timers)
+	: m_timers{ timers } {
+}
+
+template<class Base>
+retry_scheduler<Base>::~retry_scheduler() {
+	std::vector<operation *> waiting;
+	{
+		std::lock_guard lock{ m_mutex };
+		m_stopping = true;
+		for (auto &[id, target] : m_operations) {
+			if (target->cancelled) continue;
+			target->cancelled = true;
+			/// Operations which attempts are firing right now finish themselves
+			if (m_timers.cancel(target->timer)) {
+				waiting.push_back(target.get());
+			}
+		}
+	}
+	for (auto *target : waiting) {
+		finish(*target, retry_outcome::cancelled);
+	}
+
+	std::unique_lock lock{ m_mutex };
+	m_finished.wait(lock, [this] { return m_operations.empty(); });
+}
+
+template<class Base>
+u64 retry_scheduler<Base>::submit(attempt &&task, completion &&done, const backoff_policy &policy,
+	const deadline_type deadline) {
+	operation *target{};
+	auto outcome{ retry_outcome::succeeded };
+	u64 id{};
+	{
+		std::lock_guard lock{ m_mutex };
+		id = m_next_id++;
+		auto entry{ std::make_unique<operation>(operation{ id, std::move(task), std::move(done), backoff{ policy }, deadline }) };
+		target = entry.get();
+		m_operations.emplace(id, std::move(entry));
+		++m_stats.submitted;
+
+		if (m_stopping) [[unlikely]] {
+			outcome = retry_outcome::cancelled;
+		} else if (schedule(*target, time{}, outcome)) [[likely]] {
+			return id;
+		}
+	}
+	finish(*target, outcome);
+	return id;
+}
+
+template<class Base>
+bool retry_scheduler<Base>::cancel(const u64 id) {
+	operation *target{};
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto found{ m_operations.find(id) };
+		if (found == std::end(m_operations) || found->second->cancelled) return false;
+
+		target = found->second.get();
+		target->cancelled = true;
+		/// The attempt is running if the timer can't be cancelled: run() finishes the operation then
+		if (!m_timers.cancel(target->timer)) return true;
+	}
+	finish(*target, retry_outcome::cancelled);
+	return true;
+}
+
+template<class Base>
+std::size_t retry_scheduler<Base>::active() const {
+	std::lock_guard lock{ m_mutex };
+	return m_operations.size();
+}
+
+template<class Base>
+retry_stats retry_scheduler<Base>::stats() const {
+	std::lock_guard lock{ m_mutex };
+	return m_stats;
+}
+
+template<class Base>
+bool retry_scheduler<Base>::schedule(operation &target, const time delay, retry_outcome &outcome) {
+	if (const auto deadline{ target.deadline }; !deadline.is_never()
+		&& deadline.expired(base_clock::now() + delay.duration())) {
+		outcome = retry_outcome::expired;
+		return false;
+	}
+	target.timer = m_timers.arm(delay, [this, &target] { run(target); });
+	if (!target.timer.valid()) [[unlikely]] {
+		outcome = retry_outcome::rejected;
+		return false;
+	}
+	return true;
+}
+
+template<class Base>
+void retry_scheduler<Base>::run(operation &target) {
+	bool cancelled{};
+	{
+		std::lock_guard lock{ m_mutex };
+		cancelled = target.cancelled;
+	}
+
+	/// Attempts run unlocked: only this timer touches the task, and cancel() doesn't
+	const auto succeeded{ !cancelled && target.task() };
+	auto outcome{ retry_outcome::succeeded };
+	{
+		std::lock_guard lock{ m_mutex };
+		if (!cancelled) {
+			++target.attempts;
+			++m_stats.attempts;
+		}
+
+		if (succeeded) {
+			outcome = retry_outcome::succeeded;
+		} else if (target.cancelled) {
+			outcome = retry_outcome::cancelled;
+		} else if (target.delays.exhausted()) {
+			outcome = retry_outcome::exhausted;
+		} else if (schedule(target, target.delays.next(), outcome)) {
+			return;
+		}
+	}
+	finish(target, outcome);
+}
+
+template<class Base>
+void retry_scheduler<Base>::finish(operation &target, const retry_outcome outcome) {
+	if (target.done) {
+		target.done(outcome, target.attempts);
+	}
+
+	std::lock_guard lock{ m_mutex };
+	switch (outcome) {
+		case retry_outcome::succeeded: ++m_stats.succeeded; break;
+		case retry_outcome::exhausted: ++m_stats.exhausted; break;
+		case retry_outcome::expired: ++m_stats.expired; break;
+		case retry_outcome::cancelled: ++m_stats.cancelled; break;
+		case retry_outcome::rejected: ++m_stats.rejected; break;
+	}
+	/// Notified under the lock, so the destructor can't return before this call does
+	m_operations.erase(target.id);
+	m_finished.notify_all();
+}
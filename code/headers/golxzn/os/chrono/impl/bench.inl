@@ -0,0 +1,91 @@
+
+namespace details {
+
+template<class Duration>
+[[nodiscard]] constexpr f64 to_nanoseconds(const Duration duration) noexcept {
+	return std::chrono::duration<f64, std::nano>{ duration }.count();
+}
+
+template<class Callable>
+void invoke(Callable &callable) {
+	if constexpr (std::is_void_v<std::invoke_result_t<Callable &>>) {
+		std::invoke(callable);
+	} else {
+		do_not_optimize(std::invoke(callable));
+	}
+}
+
+template<class BaseClock, class Callable>
+[[nodiscard]] f64 sample(const utils::base_clock_ref<BaseClock> &clock, Callable &callable,
+		const std::size_t iterations) {
+	const auto start{ clock.now() };
+	for (std::size_t i{}; i < iterations; ++i) {
+		invoke(callable);
+	}
+	return to_nanoseconds(clock.now() - start);
+}
+
+/// Median cost of two consecutive clock reads which wrap every sample.
+template<class BaseClock>
+[[nodiscard]] f64 clock_overhead(const utils::base_clock_ref<BaseClock> &clock) {
+	static constexpr std::size_t reads{ 1024 };
+	std::vector<f64> costs(reads);
+	for (auto &cost : costs) {
+		const auto start{ clock.now() };
+		cost = to_nanoseconds(clock.now() - start);
+	}
+	const auto middle{ std::begin(costs) + reads / 2 };
+	std::nth_element(std::begin(costs), middle, std::end(costs));
+	return *middle;
+}
+
+template<class BaseClock, class Callable>
+[[nodiscard]] result run(const utils::base_clock_ref<BaseClock> &clock, Callable &callable, const options &opts) {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::bench] BaseClock is not a monotonic clock");
+	static_assert(std::is_invocable_v<Callable &>,
+		"[golxzn::os::chrono::bench] Callable is not invocable!");
+
+	const auto overhead{ clock_overhead(clock) };
+
+	const auto warmup_end{ clock.now() + opts.warmup.duration() };
+	while (clock.now() < warmup_end) {
+		invoke(callable);
+	}
+
+	const auto target{ to_nanoseconds(opts.sample_target.duration()) };
+	std::size_t iterations{ 1 };
+	while (iterations < opts.max_iterations && sample(clock, callable, iterations) - overhead < target) {
+		iterations *= 2;
+	}
+	iterations = std::min(iterations, opts.max_iterations);
+
+	std::vector<f64> samples(std::max(opts.samples, std::size_t{ 1 }));
+	for (auto &value : samples) {
+		value = std::max(sample(clock, callable, iterations) - overhead, 0.0);
+	}
+	return analyze(std::move(samples), iterations, overhead, opts);
+}
+
+} // namespace details
+
+template<class T>
+void do_not_optimize(T &&value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static const void *volatile sink{};
+	sink = std::addressof(value);
+#endif
+}
+
+template<class BaseClock, class Callable>
+result run(Callable &&callable, const options &opts) {
+	return details::run(utils::base_clock_ref<BaseClock>{}, callable, opts);
+}
+
+template<class BaseClock, class Callable, class>
+result run(BaseClock &base, Callable &&callable, const options &opts) {
+	return details::run(utils::base_clock_ref<BaseClock>{ base }, callable, opts);
+}
+
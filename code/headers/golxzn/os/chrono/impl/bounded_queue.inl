@@ -0,0 +1,189 @@
+
+template<class T>
+bounded_queue<T>::bounded_queue(const std::size_t capacity)
+	: m_mask{ [capacity] {
+		std::size_t rounded{ 2 }; // sequence numbers of a single cell can't tell full from empty
+		while (rounded < capacity) rounded <<= 1;
+		return rounded - 1;
+	}() }
+	, m_cells{ std::make_unique<cell[]>(m_mask + 1) } {
+	for (std::size_t index{}; index <= m_mask; ++index) {
+		m_cells[index].sequence.store(index, std::memory_order_relaxed);
+	}
+}
+
+template<class T>
+bounded_queue<T>::~bounded_queue() {
+	if constexpr (!std::is_trivially_destructible_v<T>) {
+		auto head{ m_head.load(std::memory_order_relaxed) };
+		const auto tail{ m_tail.load(std::memory_order_relaxed) };
+		for (; head != tail; ++head) {
+			std::launder(reinterpret_cast<T *>(m_cells[head & m_mask].storage))->~T();
+		}
+	}
+}
+
+template<class T>
+template<class U>
+bool bounded_queue<T>::try_push(U &&value) {
+	if constexpr (!std::is_nothrow_constructible_v<T, U &&>) {
+		/// Throwing construction must not leave a claimed cell behind
+		if (full()) return false;
+		return try_push(T{ std::forward<U>(value) });
+	} else {
+		auto position{ m_tail.load(std::memory_order_relaxed) };
+		cell *target{};
+		while (true) {
+			target = &m_cells[position & m_mask];
+			const auto sequence{ target->sequence.load(std::memory_order_acquire) };
+			const auto difference{ static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position) };
+			if (difference == 0) {
+				if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+			} else if (difference < 0) {
+				return false; // the cell still holds the value of the previous lap
+			} else {
+				position = m_tail.load(std::memory_order_relaxed);
+			}
+		}
+
+		::new (static_cast<void *>(target->storage)) T(std::forward<U>(value));
+		target->sequence.store(position + 1, std::memory_order_release);
+		m_readable.notify_one();
+		return true;
+	}
+}
+
+template<class T>
+template<class U, class BaseClock>
+bool bounded_queue<T>::try_push_until(U &&value, const basic_deadline<BaseClock> &deadline) {
+	static_assert(utils::has_static_now_v<BaseClock>,
+		"[golxzn::os::chrono::bounded_queue] Waiting requires BaseClock with static now()");
+
+	if constexpr (!std::is_nothrow_constructible_v<T, U &&>) {
+		/// Converted once: forwarding the value to every retry would consume it on the first failure
+		return try_push_until(T{ std::forward<U>(value) }, deadline);
+	} else {
+		for (u32 attempt{}; attempt < spin_count; ++attempt) {
+			if (try_push(std::forward<U>(value))) return true;
+		}
+		while (true) {
+			const auto epoch{ m_writable.prepare() };
+			if (try_push(std::forward<U>(value))) {
+				m_writable.finish();
+				return true;
+			}
+			const auto now{ BaseClock::now() };
+			if (deadline.expired(now)) {
+				m_writable.finish();
+				return false;
+			}
+			m_writable.wait(epoch, timeout_of(deadline, now));
+			m_writable.finish();
+		}
+	}
+}
+
+template<class T>
+template<class U>
+bool bounded_queue<T>::try_push_for(U &&value, const time timeout) {
+	return try_push_until(std::forward<U>(value), deadline::after(timeout));
+}
+
+template<class T>
+template<class U, class Rep, class Period>
+bool bounded_queue<T>::try_push_for(U &&value, const std::chrono::duration<Rep, Period> timeout) {
+	return try_push_until(std::forward<U>(value), deadline::after(timeout));
+}
+
+template<class T>
+bool bounded_queue<T>::try_pop(T &value) noexcept {
+	auto position{ m_head.load(std::memory_order_relaxed) };
+	cell *target{};
+	while (true) {
+		target = &m_cells[position & m_mask];
+		const auto sequence{ target->sequence.load(std::memory_order_acquire) };
+		const auto difference{ static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1) };
+		if (difference == 0) {
+			if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+		} else if (difference < 0) {
+			return false; // the cell isn't written yet
+		} else {
+			position = m_head.load(std::memory_order_relaxed);
+		}
+	}
+
+	auto *stored{ std::launder(reinterpret_cast<T *>(target->storage)) };
+	value = std::move(*stored);
+	stored->~T();
+	target->sequence.store(position + m_mask + 1, std::memory_order_release);
+	m_writable.notify_one();
+	return true;
+}
+
+template<class T>
+template<class BaseClock>
+bool bounded_queue<T>::try_pop_until(T &value, const basic_deadline<BaseClock> &deadline) {
+	static_assert(utils::has_static_now_v<BaseClock>,
+		"[golxzn::os::chrono::bounded_queue] Waiting requires BaseClock with static now()");
+
+	for (u32 attempt{}; attempt < spin_count; ++attempt) {
+		if (try_pop(value)) return true;
+	}
+	while (true) {
+		/// The epoch is taken before the recheck, so a push between them wakes the wait immediately
+		const auto epoch{ m_readable.prepare() };
+		if (try_pop(value)) {
+			m_readable.finish();
+			return true;
+		}
+		const auto now{ BaseClock::now() };
+		if (deadline.expired(now)) {
+			m_readable.finish();
+			return false;
+		}
+		m_readable.wait(epoch, timeout_of(deadline, now));
+		m_readable.finish();
+	}
+}
+
+template<class T>
+bool bounded_queue<T>::try_pop_for(T &value, const time timeout) {
+	return try_pop_until(value, deadline::after(timeout));
+}
+
+template<class T>
+template<class Rep, class Period>
+bool bounded_queue<T>::try_pop_for(T &value, const std::chrono::duration<Rep, Period> timeout) {
+	return try_pop_until(value, deadline::after(timeout));
+}
+
+template<class T>
+std::size_t bounded_queue<T>::capacity() const noexcept {
+	return m_mask + 1;
+}
+
+template<class T>
+std::size_t bounded_queue<T>::size() const noexcept {
+	const auto head{ m_head.load(std::memory_order_relaxed) };
+	const auto tail{ m_tail.load(std::memory_order_relaxed) };
+	return tail > head ? std::min(tail - head, capacity()) : 0;
+}
+
+template<class T>
+bool bounded_queue<T>::empty() const noexcept {
+	return size() == 0;
+}
+
+template<class T>
+bool bounded_queue<T>::full() const noexcept {
+	return size() >= capacity();
+}
+
+template<class T>
+template<class BaseClock>
+std::chrono::nanoseconds bounded_queue<T>::timeout_of(const basic_deadline<BaseClock> &deadline,
+	const typename BaseClock::time_point now) noexcept {
+	if (deadline.is_never()) return std::chrono::nanoseconds::max();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.point() - now);
+}
+
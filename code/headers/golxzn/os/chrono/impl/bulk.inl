@@ -0,0 +1,46 @@
+
+template<class Container, class Output>
+void to_seconds(const Container &values, Output &&out) noexcept {
+	to_seconds(std::data(values), std::size(values), std::data(out));
+}
+
+template<class Container, class Output>
+void to_milliseconds(const Container &values, Output &&out) noexcept {
+	to_milliseconds(std::data(values), std::size(values), std::data(out));
+}
+
+template<class Container, class Output>
+void to_microseconds(const Container &values, Output &&out) noexcept {
+	to_microseconds(std::data(values), std::size(values), std::data(out));
+}
+
+template<class Container>
+void add(Container &&values, const time offset) noexcept {
+	add(std::data(values), std::size(values), offset);
+}
+
+template<class Container>
+void subtract(Container &&values, const time offset) noexcept {
+	subtract(std::data(values), std::size(values), offset);
+}
+
+template<class Container>
+void clamp(Container &&values, const time low, const time high) noexcept {
+	clamp(std::data(values), std::size(values), low, high);
+}
+
+template<class Container>
+time min(const Container &values) noexcept {
+	return min(std::data(values), std::size(values));
+}
+
+template<class Container>
+time max(const Container &values) noexcept {
+	return max(std::data(values), std::size(values));
+}
+
+template<class Container>
+time sum(const Container &values) noexcept {
+	return sum(std::data(values), std::size(values));
+}
+
@@ -0,0 +1,97 @@
+
+template<class Base>
+constexpr basic_deadline<Base>::basic_deadline(const time_point point) noexcept
+	: m_point{ point } {}
+
+template<class Base>
+basic_deadline<Base> basic_deadline<Base>::after(const time interval) noexcept {
+	return basic_deadline{ base_clock::now() + interval.duration() };
+}
+
+template<class Base>
+template<class Rep, class Period>
+basic_deadline<Base> basic_deadline<Base>::after(const std::chrono::duration<Rep, Period> interval) noexcept {
+	return after(time{ interval });
+}
+
+template<class Base>
+basic_deadline<Base> basic_deadline<Base>::after(const base_clock &base, const time interval) noexcept {
+	return basic_deadline{ base.now() + interval.duration() };
+}
+
+template<class Base>
+constexpr basic_deadline<Base> basic_deadline<Base>::never() noexcept {
+	return basic_deadline{};
+}
+
+template<class Base>
+constexpr typename basic_deadline<Base>::time_point basic_deadline<Base>::point() const noexcept {
+	return m_point;
+}
+
+template<class Base>
+constexpr bool basic_deadline<Base>::is_never() const noexcept {
+	return m_point == time_point::max();
+}
+
+template<class Base>
+bool basic_deadline<Base>::expired() const noexcept {
+	return expired(base_clock::now());
+}
+
+template<class Base>
+constexpr bool basic_deadline<Base>::expired(const time_point now) const noexcept {
+	return now >= m_point;
+}
+
+template<class Base>
+time basic_deadline<Base>::remaining() const noexcept {
+	return remaining(base_clock::now());
+}
+
+template<class Base>
+constexpr time basic_deadline<Base>::remaining(const time_point now) const noexcept {
+	return now < m_point ? utils::difference<time>(m_point, now) : time{};
+}
+
+template<class Base>
+constexpr bool basic_deadline<Base>::operator==(const basic_deadline &rhs) const noexcept {
+	return m_point == rhs.m_point;
+}
+template<class Base>
+constexpr bool basic_deadline<Base>::operator!=(const basic_deadline &rhs) const noexcept {
+	return m_point != rhs.m_point;
+}
+template<class Base>
+constexpr bool basic_deadline<Base>::operator>=(const basic_deadline &rhs) const noexcept {
+	return m_point >= rhs.m_point;
+}
+template<class Base>
+constexpr bool basic_deadline<Base>::operator<=(const basic_deadline &rhs) const noexcept {
+	return m_point <= rhs.m_point;
+}
+template<class Base>
+constexpr bool basic_deadline<Base>::operator> (const basic_deadline &rhs) const noexcept {
+	return m_point > rhs.m_point;
+}
+template<class Base>
+constexpr bool basic_deadline<Base>::operator< (const basic_deadline &rhs) const noexcept {
+	return m_point < rhs.m_point;
+}
+
+template<class Base>
+constexpr basic_deadline<Base> min(const basic_deadline<Base> &lhs, const basic_deadline<Base> &rhs) noexcept {
+	return rhs < lhs ? rhs : lhs;
+}
+
+template<class Base>
+bool tighten(std::atomic<basic_deadline<Base>> &target, const basic_deadline<Base> candidate) noexcept {
+	auto current{ target.load(std::memory_order_relaxed) };
+	while (candidate < current) {
+		if (target.compare_exchange_weak(current, candidate, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+			return true;
+		}
+	}
+	return false;
+}
+
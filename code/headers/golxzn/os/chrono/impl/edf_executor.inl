@@ -0,0 +1,214 @@
+
+template<class Base>
+edf_executor<Base>::edf_executor(const std::size_t workers, const expired_policy policy)
+	: m_policy{ policy } {
+	launch(workers);
+}
+
+template<class Base>
+edf_executor<Base>::edf_executor(base_clock &base, const std::size_t workers, const expired_policy policy)
+	: clock_ref{ base }, m_policy{ policy } {
+	launch(workers);
+}
+
+template<class Base>
+edf_executor<Base>::~edf_executor() {
+	stop();
+}
+
+template<class Base>
+bool edf_executor<Base>::submit(task &&callback, const deadline_type deadline, expired_handler &&on_expired) {
+	if (!callback) return false;
+	{
+		/// Counted under the lock, so stop() can't let workers leave before the task is pushed
+		std::lock_guard lock{ m_mutex };
+		if (!m_running) return false;
+		m_pending.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const auto &slot{ current_worker() };
+	const auto index{ slot.owner == this
+		? slot.index
+		: m_next_heap.fetch_add(1, std::memory_order_relaxed) % m_heaps.size() };
+
+	auto &target{ *m_heaps[index] };
+	{
+		std::lock_guard lock{ target.mutex };
+		target.heap.push_back(entry{
+			deadline, m_sequence.fetch_add(1, std::memory_order_relaxed), std::move(callback), std::move(on_expired)
+		});
+		std::push_heap(std::begin(target.heap), std::end(target.heap), later);
+		publish(target);
+	}
+	m_submitted.value.fetch_add(1, std::memory_order_relaxed);
+
+	{ std::lock_guard lock{ m_mutex }; }
+	m_wakeup.notify_one();
+	return true;
+}
+
+template<class Base>
+bool edf_executor<Base>::submit(task &&callback, const time budget, expired_handler &&on_expired) {
+	return submit(std::move(callback), deadline_type{ clock_ref::now() + budget.duration() }, std::move(on_expired));
+}
+
+template<class Base>
+template<class Rep, class Period>
+bool edf_executor<Base>::submit(task &&callback, const std::chrono::duration<Rep, Period> budget,
+	expired_handler &&on_expired) {
+	return submit(std::move(callback), time{ budget }, std::move(on_expired));
+}
+
+template<class Base>
+void edf_executor<Base>::stop() {
+	{
+		std::lock_guard lock{ m_mutex };
+		m_running = false;
+	}
+	m_wakeup.notify_all();
+	for (auto &thread : m_threads) {
+		if (thread.joinable()) thread.join();
+	}
+}
+
+template<class Base>
+edf_stats edf_executor<Base>::stats() const noexcept {
+	return edf_stats{
+		m_submitted.value.load(std::memory_order_relaxed),
+		m_executed.value.load(std::memory_order_relaxed),
+		m_dropped.value.load(std::memory_order_relaxed),
+		m_late_starts.value.load(std::memory_order_relaxed),
+		m_missed.value.load(std::memory_order_relaxed),
+		m_stolen.value.load(std::memory_order_relaxed),
+	};
+}
+
+template<class Base>
+std::size_t edf_executor<Base>::pending() const noexcept {
+	return m_pending.load(std::memory_order_relaxed);
+}
+
+template<class Base>
+std::size_t edf_executor<Base>::workers() const noexcept {
+	return m_threads.size();
+}
+
+template<class Base>
+void edf_executor<Base>::launch(const std::size_t workers) {
+	const auto count{ workers != 0 ? workers : std::max<std::size_t>(std::thread::hardware_concurrency(), 1) };
+	m_heaps.reserve(count);
+	for (std::size_t index{}; index < count; ++index) {
+		m_heaps.push_back(std::make_unique<worker_heap>());
+	}
+	/// Heaps have to exist before any worker starts stealing
+	m_threads.reserve(count);
+	for (std::size_t index{}; index < count; ++index) {
+		m_threads.emplace_back([this, index] { work(index); });
+	}
+}
+
+template<class Base>
+void edf_executor<Base>::work(const std::size_t index) {
+	auto &slot{ current_worker() };
+	slot = worker_slot{ this, index };
+
+	entry target;
+	while (true) {
+		if (take(index, target)) {
+			run(target);
+			target = entry{};
+			continue;
+		}
+
+		std::unique_lock lock{ m_mutex };
+		if (m_pending.load(std::memory_order_relaxed) != 0) {
+			/// Counted task is being pushed right now
+			lock.unlock();
+			std::this_thread::yield();
+			continue;
+		}
+		if (!m_running) break;
+		m_wakeup.wait(lock, [this] { return m_pending.load(std::memory_order_relaxed) != 0 || !m_running; });
+	}
+
+	slot = worker_slot{};
+}
+
+template<class Base>
+bool edf_executor<Base>::take(const std::size_t index, entry &target) {
+	const auto count{ m_heaps.size() };
+	while (true) {
+		/// Scanning from the own heap makes it win ties, so tasks are stolen only if they're more urgent
+		std::size_t best{ count };
+		rep best_deadline{};
+		for (std::size_t offset{}; offset < count; ++offset) {
+			const auto candidate{ (index + offset) % count };
+			const auto &heap{ *m_heaps[candidate] };
+			if (heap.size.load(std::memory_order_acquire) == 0) continue;
+
+			const auto earliest{ heap.earliest.load(std::memory_order_relaxed) };
+			if (best == count || earliest < best_deadline) {
+				best = candidate;
+				best_deadline = earliest;
+			}
+		}
+		if (best == count) return false;
+
+		auto &source{ *m_heaps[best] };
+		std::lock_guard lock{ source.mutex };
+		if (source.heap.empty()) continue; // taken by another worker since the scan
+
+		std::pop_heap(std::begin(source.heap), std::end(source.heap), later);
+		target = std::move(source.heap.back());
+		source.heap.pop_back();
+		publish(source);
+
+		m_pending.fetch_sub(1, std::memory_order_relaxed);
+		if (best != index) {
+			m_stolen.value.fetch_add(1, std::memory_order_relaxed);
+		}
+		return true;
+	}
+}
+
+template<class Base>
+void edf_executor<Base>::run(entry &target) {
+	const auto started{ clock_ref::now() };
+	if (target.deadline.expired(started)) [[unlikely]] {
+		if (m_policy == expired_policy::drop) {
+			m_dropped.value.fetch_add(1, std::memory_order_relaxed);
+			if (target.on_expired) {
+				target.on_expired(utils::difference<time>(started, target.deadline.point()));
+			}
+			return;
+		}
+		m_late_starts.value.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	target.callback();
+	m_executed.value.fetch_add(1, std::memory_order_relaxed);
+	if (target.deadline.expired(clock_ref::now())) {
+		m_missed.value.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+template<class Base>
+bool edf_executor<Base>::later(const entry &lhs, const entry &rhs) noexcept {
+	if (lhs.deadline.point() != rhs.deadline.point()) return rhs.deadline.point() < lhs.deadline.point();
+	return rhs.sequence < lhs.sequence;
+}
+
+template<class Base>
+void edf_executor<Base>::publish(worker_heap &target) noexcept {
+	if (!target.heap.empty()) {
+		target.earliest.store(target.heap.front().deadline.point().time_since_epoch().count(), std::memory_order_relaxed);
+	}
+	target.size.store(target.heap.size(), std::memory_order_release);
+}
+
+template<class Base>
+typename edf_executor<Base>::worker_slot &edf_executor<Base>::current_worker() noexcept {
+	thread_local worker_slot slot;
+	return slot;
+}
+
@@ -0,0 +1,33 @@
+
+constexpr std::size_t lateness_histogram::bucket_of(const u64 microseconds) noexcept {
+	if (microseconds < sub_buckets) return static_cast<std::size_t>(microseconds);
+
+	std::size_t exponent{};
+	for (std::size_t step{ 32 }; step != 0; step /= 2) {
+		if ((microseconds >> (exponent + step)) != 0) exponent += step;
+	}
+	if (exponent > max_exponent) return buckets_count - 1;
+
+	const auto shift{ exponent - sub_bucket_bits };
+	return (shift + 1) * sub_buckets + static_cast<std::size_t>((microseconds >> shift) & (sub_buckets - 1));
+}
+
+constexpr u64 lateness_histogram::bucket_upper_bound(const std::size_t bucket) noexcept {
+	if (bucket < sub_buckets) return bucket;
+
+	const auto shift{ bucket / sub_buckets - 1 };
+	const auto lower{ static_cast<u64>(sub_buckets + bucket % sub_buckets) << shift };
+	return lower + (u64{ 1 } << shift) - 1;
+}
+
+namespace lateness {
+
+template<class TimePoint>
+void record(const TimePoint now, const TimePoint deadline) noexcept {
+	if (auto *histogram{ sink() }; histogram != nullptr) [[unlikely]] {
+		histogram->record(utils::difference<time>(now, deadline));
+	}
+}
+
+} // namespace lateness
+
@@ -0,0 +1,120 @@
+
+template<class Base>
+ewma_meter<Base>::ewma_meter(const time half_life) noexcept
+	: m_half_life{ half_life }
+	, m_inverse_tau{ std::log(2.0) / static_cast<f64>(std::max(half_life.microseconds(), i64{ 1 })) }
+	, m_last{ current() } {}
+
+template<class Base>
+ewma_meter<Base>::ewma_meter(base_clock &base, const time half_life) noexcept
+	: clock_ref{ base }
+	, m_half_life{ half_life }
+	, m_inverse_tau{ std::log(2.0) / static_cast<f64>(std::max(half_life.microseconds(), i64{ 1 })) }
+	, m_last{ current() } {}
+
+template<class Base>
+void ewma_meter<Base>::record(const time sample) noexcept {
+	const auto now{ current() };
+
+	/// Every elapsed interval is claimed by exactly one record, so the total decay is exact
+	auto last{ m_last.load(std::memory_order_relaxed) };
+	while (now > last && !m_last.compare_exchange_weak(last, now, std::memory_order_relaxed)) {}
+	const auto elapsed{ now > last ? now - last : i64{} };
+
+	const auto decay{ std::exp(-static_cast<f64>(elapsed) * m_inverse_tau) };
+	decay_and_add(m_sum, decay, static_cast<f64>(sample.microseconds()));
+	decay_and_add(m_weight, decay, 1.0);
+}
+
+template<class Base>
+time ewma_meter<Base>::value() const noexcept {
+	const auto weight{ m_weight.load(std::memory_order_relaxed) };
+	if (weight <= 0.0) return time::zero();
+	return time{ static_cast<i64>(std::llround(m_sum.load(std::memory_order_relaxed) / weight)) };
+}
+
+template<class Base>
+time ewma_meter<Base>::half_life() const noexcept {
+	return m_half_life;
+}
+
+template<class Base>
+i64 ewma_meter<Base>::current() const noexcept {
+	return utils::difference<time>(clock_ref::now(), time_point{}).microseconds();
+}
+
+template<class Base>
+void ewma_meter<Base>::decay_and_add(std::atomic<f64> &target, const f64 decay, const f64 value) noexcept {
+	auto expected{ target.load(std::memory_order_relaxed) };
+	while (!target.compare_exchange_weak(expected, expected * decay + value, std::memory_order_relaxed)) {}
+}
+
+
+template<class Base>
+sliding_window_meter<Base>::sliding_window_meter(const time window, const std::size_t buckets)
+	: m_width{ std::max(window.microseconds() / static_cast<i64>(std::max(buckets, std::size_t{ 1 })), i64{ 1 }) }
+	, m_buckets(std::max(buckets, std::size_t{ 1 })) {}
+
+template<class Base>
+sliding_window_meter<Base>::sliding_window_meter(base_clock &base, const time window, const std::size_t buckets)
+	: clock_ref{ base }
+	, m_width{ std::max(window.microseconds() / static_cast<i64>(std::max(buckets, std::size_t{ 1 })), i64{ 1 }) }
+	, m_buckets(std::max(buckets, std::size_t{ 1 })) {}
+
+template<class Base>
+void sliding_window_meter<Base>::record(const time sample) noexcept {
+	const auto epoch{ current_epoch() };
+	const auto value{ static_cast<u64>(std::max(sample.microseconds(), i64{})) };
+	auto &target{ m_buckets[static_cast<std::size_t>(epoch) % std::size(m_buckets)] };
+
+	auto stored{ target.epoch.load(std::memory_order_acquire) };
+	if (stored < epoch && target.epoch.compare_exchange_strong(stored, epoch, std::memory_order_acq_rel)) {
+		target.count.store(0, std::memory_order_relaxed);
+		target.sum.store(0, std::memory_order_relaxed);
+		target.max.store(0, std::memory_order_relaxed);
+	} else if (stored > epoch) [[unlikely]] {
+		return; // the bucket is already reused by the next lap
+	}
+
+	target.count.fetch_add(1, std::memory_order_relaxed);
+	target.sum.fetch_add(value, std::memory_order_relaxed);
+	auto current_max{ target.max.load(std::memory_order_relaxed) };
+	while (value > current_max
+		&& !target.max.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {}
+}
+
+template<class Base>
+window_stats sliding_window_meter<Base>::stats() const noexcept {
+	const auto epoch{ current_epoch() };
+	const auto oldest{ epoch - static_cast<i64>(std::size(m_buckets)) };
+
+	u64 count{};
+	u64 sum{};
+	u64 max{};
+	for (const auto &target : m_buckets) {
+		const auto stored{ target.epoch.load(std::memory_order_acquire) };
+		if (stored <= oldest || stored > epoch) continue;
+
+		count += target.count.load(std::memory_order_relaxed);
+		sum += target.sum.load(std::memory_order_relaxed);
+		max = std::max(max, target.max.load(std::memory_order_relaxed));
+	}
+
+	window_stats result;
+	result.count = count;
+	result.sum = time{ static_cast<i64>(sum) };
+	result.mean = count != 0 ? time{ static_cast<i64>(sum / count) } : time::zero();
+	result.max = time{ static_cast<i64>(max) };
+	return result;
+}
+
+template<class Base>
+time sliding_window_meter<Base>::window() const noexcept {
+	return time{ m_width * static_cast<i64>(std::size(m_buckets)) };
+}
+
+template<class Base>
+i64 sliding_window_meter<Base>::current_epoch() const noexcept {
+	return utils::difference<time>(clock_ref::now(), time_point{}).microseconds() / m_width;
+}
+
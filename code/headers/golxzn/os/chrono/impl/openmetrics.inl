@@ -0,0 +1,24 @@
+
+template<class BaseClock>
+void writer::gauge(std::string_view name, const ewma_meter<BaseClock> &meter, std::string_view help) {
+	gauge(name, meter.value(), help);
+}
+
+template<class BaseClock>
+void writer::window(std::string_view name, const sliding_window_meter<BaseClock> &meter, std::string_view help) {
+	const auto stats{ meter.stats() };
+
+	/// Not a summary: its _count and _sum are counters, but window values go down when buckets expire
+	family(name, "_window_count", "gauge", help);
+	sample(name, "_window_count");
+	append(stats.count);
+
+	family(name, "_window_sum", "gauge", help);
+	sample(name, "_window_sum");
+	append_seconds(stats.sum.microseconds());
+
+	family(name, "_max", "gauge", help);
+	sample(name, "_max");
+	append_seconds(stats.max.microseconds());
+}
+
@@ -0,0 +1,46 @@
+
+template<class Base>
+perf_clock<Base>::perf_clock() noexcept
+	: m_counters_valid{ perf::read(m_last_counters) }
+	, m_last_time{ clock_ref::now() } {}
+
+template<class Base>
+perf_clock<Base>::perf_clock(base_clock &base) noexcept
+	: clock_ref{ base }
+	, m_counters_valid{ perf::read(m_last_counters) }
+	, m_last_time{ clock_ref::now() } {}
+
+template<class Base>
+perf_sample perf_clock<Base>::elapsed() noexcept {
+	/// Time is read before counters, so the cost of counters read isn't counted in the elapsed time
+	const auto current_time{ clock_ref::now() };
+	perf::counters current;
+	const auto valid{ m_counters_valid && perf::read(current) };
+
+	perf_sample sample;
+	sample.elapsed = utils::difference<time>(current_time, std::exchange(m_last_time, current_time));
+	if (valid) {
+		sample.counters_valid = true;
+		sample.counters.cycles = current.cycles - m_last_counters.cycles;
+		sample.counters.instructions = current.instructions - m_last_counters.instructions;
+		sample.counters.cache_misses = current.cache_misses - m_last_counters.cache_misses;
+		sample.counters.branch_misses = current.branch_misses - m_last_counters.branch_misses;
+	}
+	m_last_counters = current;
+	m_counters_valid = valid;
+	return sample;
+}
+
+template<class Base>
+perf_scope<Base>::perf_scope(perf_sample &out) noexcept
+	: m_out{ out } {}
+
+template<class Base>
+perf_scope<Base>::perf_scope(Base &base, perf_sample &out) noexcept
+	: m_out{ out }, m_clock{ base } {}
+
+template<class Base>
+perf_scope<Base>::~perf_scope() {
+	m_out = m_clock.elapsed();
+}
+
@@ -0,0 +1,207 @@
+
+template<class Base>
+periodic_scheduler<Base>::periodic_scheduler(base_clock &base) noexcept
+	: clock_ref{ base } {}
+
+template<class Base>
+periodic_scheduler<Base>::~periodic_scheduler() {
+#if defined(GOLXZN_MULTITHREADING)
+	stop();
+#endif // defined(GOLXZN_MULTITHREADING)
+}
+
+template<class Base>
+typename periodic_scheduler<Base>::job_id periodic_scheduler<Base>::add(std::string_view key, const time period, job &&callback) {
+	return insert(true, hash(key), period, std::move(callback));
+}
+
+template<class Base>
+typename periodic_scheduler<Base>::job_id periodic_scheduler<Base>::add(const time period, job &&callback) {
+	return insert(false, u64{}, period, std::move(callback));
+}
+
+template<class Base>
+bool periodic_scheduler<Base>::remove(const job_id id) {
+	std::lock_guard lock{ m_mutex };
+	const auto found{ m_jobs.find(id) };
+	if (found == std::end(m_jobs)) return false;
+
+	m_queue.erase(queue_key{ found->second.next, id });
+	m_jobs.erase(found);
+	return true;
+}
+
+template<class Base>
+bool periodic_scheduler<Base>::set_period(const job_id id, const time period) {
+	if (period <= time::zero()) return false;
+
+	const auto now{ current() };
+	std::lock_guard lock{ m_mutex };
+	const auto found{ m_jobs.find(id) };
+	if (found == std::end(m_jobs)) return false;
+
+	auto &target{ found->second };
+	m_queue.erase(queue_key{ target.next, id });
+	target.period = period.microseconds();
+	target.next = next_fire(now, target.period, target.hash);
+	if (m_queue.emplace(target.next, id).first == std::begin(m_queue)) {
+		notify();
+	}
+	return true;
+}
+
+template<class Base>
+std::size_t periodic_scheduler<Base>::tick() {
+	const auto now{ current() };
+	const auto now_point{ to_point(now) };
+
+	std::vector<std::shared_ptr<job>> due;
+	std::shared_ptr<tick_observer> observer;
+	{
+		std::lock_guard lock{ m_mutex };
+		while (!m_queue.empty() && std::begin(m_queue)->first <= now) {
+			const auto id{ std::begin(m_queue)->second };
+			m_queue.erase(std::begin(m_queue));
+
+			auto &target{ m_jobs.at(id) };
+			lateness::record(now_point, to_point(target.next));
+			target.next = next_fire(now, target.period, target.hash);
+			m_queue.emplace(target.next, id);
+			due.push_back(target.callback);
+		}
+		observer = m_observer;
+	}
+
+	for (const auto &callback : due) {
+		(*callback)();
+	}
+	if (observer) {
+		(*observer)(now_point, due.size());
+	}
+	return due.size();
+}
+
+template<class Base>
+void periodic_scheduler<Base>::on_tick(tick_observer &&observer) {
+	auto shared{ observer ? std::make_shared<tick_observer>(std::move(observer)) : nullptr };
+	std::lock_guard lock{ m_mutex };
+	m_observer = std::move(shared);
+}
+
+template<class Base>
+basic_deadline<Base> periodic_scheduler<Base>::next() const {
+	std::lock_guard lock{ m_mutex };
+	if (m_queue.empty()) return basic_deadline<Base>::never();
+	return basic_deadline<Base>{ to_point(std::begin(m_queue)->first) };
+}
+
+template<class Base>
+std::size_t periodic_scheduler<Base>::size() const {
+	std::lock_guard lock{ m_mutex };
+	return m_jobs.size();
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+template<class Base>
+void periodic_scheduler<Base>::start() {
+	std::lock_guard lock{ m_mutex };
+	if (m_running) return;
+
+	m_running = true;
+	m_thread = std::thread([this] {
+		std::unique_lock lock{ m_mutex };
+		while (m_running) {
+			if (m_queue.empty()) {
+				m_wakeup.wait(lock);
+				continue;
+			}
+
+			const auto left{ std::begin(m_queue)->first - current() };
+			if (left > 0) {
+				m_wakeup.wait_for(lock, std::chrono::microseconds{ left });
+				continue;
+			}
+
+			lock.unlock();
+			tick();
+			lock.lock();
+		}
+	});
+}
+
+template<class Base>
+void periodic_scheduler<Base>::stop() {
+	{
+		std::lock_guard lock{ m_mutex };
+		m_running = false;
+	}
+	m_wakeup.notify_all();
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+}
+#endif // defined(GOLXZN_MULTITHREADING)
+
+template<class Base>
+i64 periodic_scheduler<Base>::current() const noexcept {
+	return utils::difference<time>(clock_ref::now(), time_point{}).microseconds();
+}
+
+template<class Base>
+typename periodic_scheduler<Base>::time_point periodic_scheduler<Base>::to_point(const i64 microseconds) const noexcept {
+	return time_point{} + std::chrono::duration_cast<typename time_point::duration>(std::chrono::microseconds{ microseconds });
+}
+
+template<class Base>
+typename periodic_scheduler<Base>::job_id periodic_scheduler<Base>::insert(const bool keyed, const u64 key_hash, const time period, job &&callback) {
+	if (period <= time::zero() || !callback) return invalid_job;
+
+	const auto now{ current() };
+	auto shared{ std::make_shared<job>(std::move(callback)) };
+
+	std::lock_guard lock{ m_mutex };
+	const auto id{ ++m_last_id };
+	const auto job_hash{ keyed ? key_hash : hash(id) };
+	const auto next{ next_fire(now, period.microseconds(), job_hash) };
+	m_jobs.emplace(id, entry{ period.microseconds(), job_hash, next, std::move(shared) });
+	if (m_queue.emplace(next, id).first == std::begin(m_queue)) {
+		notify();
+	}
+	return id;
+}
+
+template<class Base>
+void periodic_scheduler<Base>::notify() noexcept {
+#if defined(GOLXZN_MULTITHREADING)
+	m_wakeup.notify_all();
+#endif // defined(GOLXZN_MULTITHREADING)
+}
+
+template<class Base>
+i64 periodic_scheduler<Base>::next_fire(const i64 now, const i64 period, const u64 seed) noexcept {
+	const auto phase{ static_cast<i64>(seed % static_cast<u64>(period)) };
+	const auto since{ now - phase };
+	/// Floor division, so points before the first grid point are handled too
+	const auto grid{ since / period - (since % period < 0 ? 1 : 0) };
+	return (grid + 1) * period + phase;
+}
+
+template<class Base>
+u64 periodic_scheduler<Base>::hash(std::string_view key) noexcept {
+	/// FNV-1a finalized with splitmix64 step, so similar keys get distant phases
+	u64 value{ 0xcbf29ce484222325 };
+	for (const auto symbol : key) {
+		value = (value ^ static_cast<u8>(symbol)) * 0x100000001b3;
+	}
+	return hash(value);
+}
+
+template<class Base>
+u64 periodic_scheduler<Base>::hash(const job_id id) noexcept {
+	/// splitmix64 finalizer
+	u64 value{ id + 0x9e3779b97f4a7c15 };
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+	return value ^ (value >> 31);
+}
+
@@ -0,0 +1,16 @@
+
+template<class BaseClock>
+recording_clock<BaseClock>::recording_clock(clock_recording &recording) noexcept
+	: m_recording{ recording } {}
+
+template<class BaseClock>
+recording_clock<BaseClock>::recording_clock(base_clock &base, clock_recording &recording) noexcept
+	: clock_ref{ base }, m_recording{ recording } {}
+
+template<class BaseClock>
+typename recording_clock<BaseClock>::time_point recording_clock<BaseClock>::now() const noexcept {
+	const auto value{ std::chrono::duration_cast<duration>(clock_ref::now().time_since_epoch()) };
+	m_recording.append(value.count());
+	return time_point{ value };
+}
+
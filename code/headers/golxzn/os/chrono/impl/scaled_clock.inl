@@ -0,0 +1,96 @@
+
+template<class Base>
+scaled_clock<Base>::scaled_clock() noexcept
+	: m_start{ clock_ref::now() } {}
+
+template<class Base>
+scaled_clock<Base>::scaled_clock(base_clock &base) noexcept
+	: clock_ref{ base }, m_start{ clock_ref::now() } {}
+
+template<class Base>
+scaled_clock<Base>::scaled_clock(const scaled_clock &parent, const f64 rate) noexcept
+	: clock_ref{ static_cast<const clock_ref &>(parent) }
+	, m_parent{ &parent }
+	, m_root{ parent.m_root }
+	, m_parent_anchor{ parent.value() }
+	, m_rate{ rate } {}
+
+template<class Base>
+time scaled_clock<Base>::update() noexcept {
+	auto &root{ *m_root };
+	root.m_base_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(root.clock_ref::now() - root.m_start).count();
+	++root.m_frame;
+	return elapsed();
+}
+
+template<class Base>
+time scaled_clock<Base>::elapsed() const noexcept {
+	return time{ std::chrono::nanoseconds{ value() } };
+}
+
+template<class Base>
+u64 scaled_clock<Base>::frame() const noexcept {
+	return m_root->m_frame;
+}
+
+template<class Base>
+f64 scaled_clock<Base>::rate() const noexcept {
+	return m_rate;
+}
+
+template<class Base>
+void scaled_clock<Base>::set_rate(const f64 rate) noexcept {
+	rebase();
+	m_rate = rate;
+}
+
+template<class Base>
+bool scaled_clock<Base>::paused() const noexcept {
+	return m_paused;
+}
+
+template<class Base>
+void scaled_clock<Base>::pause() noexcept {
+	if (m_paused) return;
+	rebase();
+	m_paused = true;
+}
+
+template<class Base>
+void scaled_clock<Base>::resume() noexcept {
+	if (!m_paused) return;
+	rebase();
+	m_paused = false;
+}
+
+template<class Base>
+bool scaled_clock<Base>::is_root() const noexcept {
+	return m_parent == nullptr;
+}
+
+template<class Base>
+typename scaled_clock<Base>::rep scaled_clock<Base>::value() const noexcept {
+	const auto current_frame{ m_root->m_frame };
+	if (m_cached_frame == current_frame) return m_cached;
+
+	if (m_paused) {
+		m_cached = m_anchor;
+	} else {
+		const auto passed{ source() - m_parent_anchor };
+		m_cached = m_anchor + (m_rate == 1.0 ? passed : static_cast<rep>(static_cast<f64>(passed) * m_rate));
+	}
+	m_cached_frame = current_frame;
+	return m_cached;
+}
+
+template<class Base>
+typename scaled_clock<Base>::rep scaled_clock<Base>::source() const noexcept {
+	return m_parent != nullptr ? m_parent->value() : m_base_elapsed;
+}
+
+template<class Base>
+void scaled_clock<Base>::rebase() noexcept {
+	/// The current value becomes the new starting point, so the change doesn't move time retroactively
+	m_anchor = value();
+	m_parent_anchor = source();
+}
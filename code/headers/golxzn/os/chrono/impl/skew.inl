@@ -0,0 +1,117 @@
+
+namespace details {
+
+template<class BaseClock>
+class skew_checker {
+public:
+	explicit skew_checker(const utils::base_clock_ref<BaseClock> clock) noexcept : m_clock{ clock } {}
+
+	[[nodiscard]] skew_report run(const skew_options &options) const {
+		auto cores{ options.cores.empty() ? available_cores() : options.cores };
+
+		skew_report report;
+		report.cores.reserve(std::size(cores));
+		for (const auto core : cores) {
+			report.cores.push_back(measure(core, options.reads));
+		}
+
+		report.pairs.reserve(std::size(cores) * (std::size(cores) - 1) / 2);
+		for (std::size_t first{}; first < std::size(cores); ++first) {
+			for (std::size_t second{ first + 1 }; second < std::size(cores); ++second) {
+				report.pairs.push_back(exchange(cores[first], cores[second], options.rounds));
+			}
+		}
+		return report;
+	}
+
+private:
+	/// The request, the answer and the timestamp share one cache line, so each exchange is one transfer each way
+	struct alignas(64) mailbox {
+		std::atomic<u32> request{};
+		std::atomic<u32> response{};
+		std::atomic<i64> stamp{};
+	};
+
+	const utils::base_clock_ref<BaseClock> m_clock;
+
+	[[nodiscard]] std::chrono::nanoseconds read() const noexcept {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(m_clock.now().time_since_epoch());
+	}
+
+	[[nodiscard]] core_skew measure(const u32 core, const u32 reads) const {
+		core_skew result;
+		result.core = core;
+		std::thread{ [this, &result, core, reads] {
+			result.pinned = pin_current_thread(core);
+
+			const auto first{ read() };
+			auto last{ first };
+			for (u32 index{}; index < reads; ++index) {
+				const auto current{ read() };
+				if (current < last) ++result.violations;
+				last = current;
+			}
+			if (reads != 0 && last > first) {
+				result.cost = (last - first) / reads;
+			}
+		} }.join();
+		return result;
+	}
+
+	[[nodiscard]] pair_skew exchange(const u32 first, const u32 second, const u32 rounds) const {
+		pair_skew result;
+		result.first = first;
+		result.second = second;
+		result.round_trip = std::chrono::nanoseconds::max();
+
+		mailbox box;
+		std::thread responder{ [this, &box, second, rounds] {
+			const auto pinned{ pin_current_thread(second) };
+			for (u32 round{ 1 }; round <= rounds; ++round) {
+				while (box.request.load(std::memory_order_acquire) != round) {
+					if (!pinned) std::this_thread::yield(); // both threads could share one core
+				}
+				box.stamp.store(read().count(), std::memory_order_relaxed);
+				box.response.store(round, std::memory_order_release);
+			}
+		} };
+		std::thread initiator{ [this, &box, &result, first, rounds] {
+			const auto pinned{ pin_current_thread(first) };
+			for (u32 round{ 1 }; round <= rounds; ++round) {
+				const auto sent{ read() };
+				box.request.store(round, std::memory_order_release);
+				while (box.response.load(std::memory_order_acquire) != round) {
+					if (!pinned) std::this_thread::yield();
+				}
+				const auto received{ read() };
+				const std::chrono::nanoseconds answered{ box.stamp.load(std::memory_order_relaxed) };
+
+				if (answered < sent || received < answered) ++result.violations;
+				if (received - sent < result.round_trip) {
+					result.round_trip = received - sent;
+					result.offset = answered - (sent + result.round_trip / 2);
+				}
+			}
+		} };
+		initiator.join();
+		responder.join();
+
+		if (rounds == 0) result.round_trip = std::chrono::nanoseconds::zero();
+		return result;
+	}
+};
+
+} // namespace details
+
+template<class BaseClock>
+skew_report check_skew(const skew_options &options) {
+	static_assert(utils::has_static_now_v<BaseClock>,
+		"[golxzn::os::chrono::check_skew] Stateful BaseClock has to be passed as the first argument");
+	return details::skew_checker<BaseClock>{ utils::base_clock_ref<BaseClock>{} }.run(options);
+}
+
+template<class BaseClock>
+skew_report check_skew(BaseClock &base, const skew_options &options) {
+	return details::skew_checker<BaseClock>{ utils::base_clock_ref<BaseClock>{ base } }.run(options);
+}
+
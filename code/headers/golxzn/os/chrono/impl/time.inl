@@ -218,8 +218,8 @@ template<class T>
 
 
 [[nodiscard]] constexpr time operator-(const time &rhs) noexcept { return microseconds(-rhs.microseconds()); }
-[[nodiscard]] constexpr time operator-(const time &lhs, const time &rhs) noexcept { return time{ lhs } - rhs; }
-[[nodiscard]] constexpr time operator+(const time &lhs, const time &rhs) noexcept { return time{ lhs } + rhs; }
+[[nodiscard]] constexpr time operator-(const time &lhs, const time &rhs) noexcept { return time{ lhs.duration() - rhs.duration() }; }
+[[nodiscard]] constexpr time operator+(const time &lhs, const time &rhs) noexcept { return time{ lhs.duration() + rhs.duration() }; }
 
 template<class T>
 [[nodiscard]] constexpr time operator-(const time &lhs, const utils::floating_point_t<T> rhs) noexcept{ return lhs - time{ rhs }; }
@@ -0,0 +1,101 @@
+
+template<class Base>
+time_series_ring<Base>::time_series_ring(const time granularity, const std::size_t intervals,
+		const std::size_t series, const std::size_t stripes)
+	: m_granularity{ std::max(granularity.microseconds(), i64{ 1 }) }
+	, m_intervals{ std::max(intervals, std::size_t{ 1 }) }
+	, m_series{ std::max(series, std::size_t{ 1 }) }
+	, m_stripes{ stripes != 0 ? stripes : std::max<std::size_t>(std::thread::hardware_concurrency(), 1) }
+	, m_lines_per_stripe{ (m_series + counters_per_line - 1) / counters_per_line }
+	, m_epochs{ std::make_unique<interval_epoch[]>(m_intervals) }
+	, m_lines{ std::make_unique<line[]>(m_intervals * m_stripes * m_lines_per_stripe) } {}
+
+template<class Base>
+time_series_ring<Base>::time_series_ring(base_clock &base, const time granularity, const std::size_t intervals,
+		const std::size_t series, const std::size_t stripes)
+	: clock_ref{ base }
+	, m_granularity{ std::max(granularity.microseconds(), i64{ 1 }) }
+	, m_intervals{ std::max(intervals, std::size_t{ 1 }) }
+	, m_series{ std::max(series, std::size_t{ 1 }) }
+	, m_stripes{ stripes != 0 ? stripes : std::max<std::size_t>(std::thread::hardware_concurrency(), 1) }
+	, m_lines_per_stripe{ (m_series + counters_per_line - 1) / counters_per_line }
+	, m_epochs{ std::make_unique<interval_epoch[]>(m_intervals) }
+	, m_lines{ std::make_unique<line[]>(m_intervals * m_stripes * m_lines_per_stripe) } {}
+
+template<class Base>
+void time_series_ring<Base>::add(const u64 value, const std::size_t series) noexcept {
+	if (series >= m_series) [[unlikely]] return;
+
+	const auto epoch{ current_epoch() };
+	const auto interval{ static_cast<std::size_t>(epoch) % m_intervals };
+	auto &stored_epoch{ m_epochs[interval].value };
+
+	auto stored{ stored_epoch.load(std::memory_order_acquire) };
+	if (stored < epoch && stored_epoch.compare_exchange_strong(stored, epoch, std::memory_order_acq_rel)) {
+		/// Lazy rotation: the interval is reused, so the first writer zeroes it
+		for (std::size_t stripe{}; stripe < m_stripes; ++stripe) {
+			for (std::size_t index{}; index < m_series; ++index) {
+				counter(interval, stripe, index).store(0, std::memory_order_relaxed);
+			}
+		}
+	} else if (stored > epoch) [[unlikely]] {
+		return; // the interval is already reused by the next lap
+	}
+
+	counter(interval, details::thread_index() % m_stripes, series).fetch_add(value, std::memory_order_relaxed);
+}
+
+template<class Base>
+time_series time_series_ring<Base>::snapshot(const std::size_t series) const {
+	const auto epoch{ current_epoch() };
+	const auto first{ epoch - static_cast<i64>(m_intervals) + 1 };
+
+	time_series result;
+	result.start = time{ first * m_granularity };
+	result.granularity = time{ m_granularity };
+	result.values.resize(m_intervals);
+	if (series >= m_series) return result;
+
+	for (std::size_t offset{}; offset < m_intervals; ++offset) {
+		const auto expected{ first + static_cast<i64>(offset) };
+		if (expected < 0) continue;
+
+		const auto interval{ static_cast<std::size_t>(expected) % m_intervals };
+		if (m_epochs[interval].value.load(std::memory_order_acquire) != expected) continue;
+
+		u64 sum{};
+		for (std::size_t stripe{}; stripe < m_stripes; ++stripe) {
+			sum += counter(interval, stripe, series).load(std::memory_order_relaxed);
+		}
+		result.values[offset] = sum;
+	}
+	return result;
+}
+
+template<class Base>
+time time_series_ring<Base>::granularity() const noexcept {
+	return time{ m_granularity };
+}
+
+template<class Base>
+std::size_t time_series_ring<Base>::intervals() const noexcept {
+	return m_intervals;
+}
+
+template<class Base>
+std::size_t time_series_ring<Base>::series() const noexcept {
+	return m_series;
+}
+
+template<class Base>
+i64 time_series_ring<Base>::current_epoch() const noexcept {
+	return utils::difference<time>(clock_ref::now(), time_point{}).microseconds() / m_granularity;
+}
+
+template<class Base>
+std::atomic<u64> &time_series_ring<Base>::counter(const std::size_t interval, const std::size_t stripe,
+		const std::size_t series) const noexcept {
+	auto &target{ m_lines[(interval * m_stripes + stripe) * m_lines_per_stripe + series / counters_per_line] };
+	return target.values[series % counters_per_line];
+}
+
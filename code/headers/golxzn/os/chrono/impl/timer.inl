@@ -7,29 +7,49 @@ timer<CB, Base>::timer(const std::chrono::duration<Rep, Period> timer_interval,
 		, const std::chrono::microseconds precision
 #endif // defined(GOLXZN_MULTITHREADING)
 )
-	: m_timer_interval{ timer_interval }
-#if !defined(GOLXZN_MULTITHREADING)
-	, m_callback{ std::move(callback) }
+	: m_deadline{ clock_ref::now() + std::chrono::duration_cast<typename time_point::duration>(timer_interval) }
+	, m_callback{ std::move(callback) } {
+
+#if defined(GOLXZN_MULTITHREADING)
+	start(precision);
 #endif // defined(GOLXZN_MULTITHREADING)
-{
+}
 
+template<class CB, class Base>
+timer<CB, Base>::timer(const time timer_interval, timer_end_callback &&callback
 #if defined(GOLXZN_MULTITHREADING)
+		, const std::chrono::microseconds precision
+#endif // defined(GOLXZN_MULTITHREADING)
+)
+	: timer{ timer_interval.duration(), std::move(callback)
+#if defined(GOLXZN_MULTITHREADING)
+	, precision
+#endif // defined(GOLXZN_MULTITHREADING)
+} { }
 
-	m_timer_thread = std::thread([this, cb = callback, precision] {
-		while (is_running()) [[likely]] { std::this_thread::sleep_for(precision); }
-		cb();
-	});
+template<class CB, class Base>
+template<class Rep, class Period>
+timer<CB, Base>::timer(base_clock &base, const std::chrono::duration<Rep, Period> timer_interval, timer_end_callback &&callback
+#if defined(GOLXZN_MULTITHREADING)
+		, const std::chrono::microseconds precision
+#endif // defined(GOLXZN_MULTITHREADING)
+)
+	: clock_ref{ base }
+	, m_deadline{ clock_ref::now() + std::chrono::duration_cast<typename time_point::duration>(timer_interval) }
+	, m_callback{ std::move(callback) } {
 
+#if defined(GOLXZN_MULTITHREADING)
+	start(precision);
 #endif // defined(GOLXZN_MULTITHREADING)
 }
 
 template<class CB, class Base>
-timer<CB, Base>::timer(const time timer_interval, timer_end_callback &&callback
+timer<CB, Base>::timer(base_clock &base, const time timer_interval, timer_end_callback &&callback
 #if defined(GOLXZN_MULTITHREADING)
 		, const std::chrono::microseconds precision
 #endif // defined(GOLXZN_MULTITHREADING)
 )
-	: timer{ timer_interval.duration(), std::move(callback)
+	: timer{ base, timer_interval.duration(), std::move(callback)
 #if defined(GOLXZN_MULTITHREADING)
 	, precision
 #endif // defined(GOLXZN_MULTITHREADING)
@@ -38,18 +58,110 @@ timer<CB, Base>::timer(const time timer_interval, timer_end_callback &&callback
 #if defined(GOLXZN_MULTITHREADING)
 template<class CB, class Base>
 timer<CB, Base>::~timer() noexcept {
-	if (m_timer_thread.joinable()) {
-		m_timer_thread.join();
+	if constexpr (service_dispatch) {
+		if (m_helper.joinable()) {
+			/// The helper has to stop waiting for the deadline, because the driver mustn't wait for it
+			if (details::is_timer_driver()) {
+				m_released.notify();
+			}
+			m_helper.join();
+			if (!m_completion.done()) {
+				release();
+			}
+			return;
+		}
+		/// Waiting on a driver could wait for the driver itself (e.g. a timer made in a timer callback),
+		/// so the pending timer is taken back from the service instead
+		if (details::is_timer_driver() && details::shared_timer_service<Base>().cancel(m_dispatcher)) {
+			release();
+			return;
+		}
+		m_completion.wait();
+	} else if constexpr (clock_dispatch) {
+		/// The clock calls tasks unlocked, so the callback could be running on the thread which advances it
+		if (!clock_ref::base().cancel(m_dispatcher)) {
+			m_completion.wait();
+		}
+	} else if (m_dispatcher.joinable()) {
+		m_dispatcher.join();
+	}
+}
+
+template<class CB, class Base>
+void timer<CB, Base>::start([[maybe_unused]] const std::chrono::microseconds precision) {
+	if constexpr (service_dispatch) {
+		auto &service{ details::shared_timer_service<Base>() };
+		/// A full service frees slots by firing the earliest timers, but not while its driver calls this
+		for (u32 attempt{}; attempt < arm_attempts; ++attempt) {
+			if ((m_dispatcher = service.arm(m_deadline, [this] { fire(); })).valid()) [[likely]] return;
+			if (details::is_timer_driver()) break;
+			std::this_thread::yield();
+		}
+		m_helper = std::thread([this] {
+			if (m_released.wait_until(m_deadline.point())) return;
+			lateness::record(clock_ref::now(), m_deadline.point());
+			fire();
+		});
+	} else if constexpr (clock_dispatch) {
+		m_dispatcher = clock_ref::base().schedule(m_deadline.point(), [this] { fire(); });
 	} else {
-		m_timer_thread.detach();
+		m_dispatcher = std::thread([this, precision] {
+			while (is_running()) [[likely]] { std::this_thread::sleep_for(precision); }
+			fire();
+		});
+	}
+}
+
+template<class CB, class Base>
+void timer<CB, Base>::fire() {
+	if constexpr (!service_dispatch) {
+		/// The service records lateness of its timers itself
+		lateness::record(clock_ref::now(), m_deadline.point());
+	}
+	m_callback();
+	if constexpr (service_dispatch || clock_dispatch) {
+		m_completion.notify();
+	}
+}
+
+template<class CB, class Base>
+void timer<CB, Base>::release() {
+	if (const auto now{ clock_ref::now() }; m_deadline.expired(now)) {
+		lateness::record(now, m_deadline.point());
+		m_callback();
+		return;
 	}
+
+	/// Sleeping here would delay every timer of the driver's shard, so the callback leaves with its own thread
+	std::thread{ [callback = std::move(m_callback), deadline = m_deadline]() mutable {
+		std::this_thread::sleep_until(deadline.point());
+		lateness::record(Base::now(), deadline.point());
+		callback();
+	} }.detach();
 }
+
+namespace details {
+
+template<class Clock, class Duration>
+bool timer_completion::wait_until(const std::chrono::time_point<Clock, Duration> point) noexcept {
+	std::unique_lock lock{ m_mutex };
+	return m_condition.wait_until(lock, point, [this] { return m_done; });
+}
+
+template<class BaseClock>
+sharded_timer_service<BaseClock> &shared_timer_service() {
+	static sharded_timer_service<BaseClock> service;
+	return service;
+}
+
+} // namespace details
 #endif // defined(GOLXZN_MULTITHREADING)
 
 #if !defined(GOLXZN_MULTITHREADING)
 template<class CB, class Base>
 void timer<CB, Base>::update() {
-	if (is_done()) [[unlikely]] {
+	if (const auto now{ clock_ref::now() }; m_deadline.expired(now)) [[unlikely]] {
+		lateness::record(now, m_deadline.point());
 		m_callback();
 	}
 }
@@ -57,7 +169,7 @@ void timer<CB, Base>::update() {
 
 template<class CB, class Base>
 bool timer<CB, Base>::is_done() const noexcept {
-	return utils::difference<time_point>(base_clock::now(), m_start_time) >= m_timer_interval;
+	return m_deadline.expired(clock_ref::now());
 }
 
 template<class CB, class Base>
@@ -67,29 +179,51 @@ bool timer<CB, Base>::is_running() const noexcept {
 
 template<class CB, class Base>
 time timer<CB, Base>::time_left() const noexcept {
-	const auto diff{ utils::difference<time_point>(base_clock::now(), m_start_time) };
-	return diff < m_timer_interval ? utils::difference<time>(m_timer_interval, diff) : time{};
+	return m_deadline.remaining(clock_ref::now());
 }
 
 template<class Base>
 constexpr fast_timer<Base>::fast_timer(const time timer_interval) noexcept
-	: fast_timer{ static_cast<time_point>(timer_interval) } {
+	: fast_timer{ timer_interval.duration() } {
 }
 
 template<class Base>
 constexpr fast_timer<Base>::fast_timer(const time_point timer_interval) noexcept
-	: m_timer_interval{ timer_interval }
+	: m_deadline{ clock_ref::now() + timer_interval.time_since_epoch() }
 {}
 
 template<class Base>
 template<class Rep, class Period>
 constexpr fast_timer<Base>::fast_timer(const std::chrono::duration<Rep, Period> timer_interval) noexcept
-	: m_timer_interval{ timer_interval } {
+	: m_deadline{ clock_ref::now() + std::chrono::duration_cast<typename time_point::duration>(timer_interval) } {
+}
+
+template<class Base>
+constexpr fast_timer<Base>::fast_timer(base_clock &base, const time timer_interval) noexcept
+	: fast_timer{ base, timer_interval.duration() } {
+}
+
+template<class Base>
+template<class Rep, class Period>
+constexpr fast_timer<Base>::fast_timer(base_clock &base, const std::chrono::duration<Rep, Period> timer_interval) noexcept
+	: clock_ref{ base }
+	, m_deadline{ clock_ref::now() + std::chrono::duration_cast<typename time_point::duration>(timer_interval) } {
+}
+
+template<class Base>
+constexpr fast_timer<Base>::fast_timer(const basic_deadline<Base> until) noexcept
+	: m_deadline{ until } {
+}
+
+template<class Base>
+constexpr fast_timer<Base>::fast_timer(base_clock &base, const basic_deadline<Base> until) noexcept
+	: clock_ref{ base }
+	, m_deadline{ until } {
 }
 
 template<class Base>
 constexpr bool fast_timer<Base>::is_done() const noexcept {
-	return utils::difference<time_point>(base_clock::now(), m_start_time) >= m_timer_interval;
+	return m_deadline.expired(clock_ref::now());
 }
 
 template<class Base>
@@ -99,7 +233,11 @@ constexpr bool fast_timer<Base>::is_running() const noexcept {
 
 template<class Base>
 constexpr time fast_timer<Base>::time_left() const noexcept {
-	const auto diff{ utils::difference<time_point>(base_clock::now(), m_start_time) };
-	return diff < m_timer_interval ? utils::difference<time>(m_timer_interval, diff) : time{};
+	return m_deadline.remaining(clock_ref::now());
+}
+
+template<class Base>
+constexpr basic_deadline<Base> fast_timer<Base>::deadline() const noexcept {
+	return m_deadline;
 }
 
@@ -0,0 +1,453 @@
+
+template<class Base>
+timer_service<Base>::timer_service(const std::size_t capacity)
+	: m_capacity{ static_cast<u32>(std::clamp<std::size_t>(capacity, 1, no_slot - 1)) }
+	, m_slots{ std::make_unique<slot[]>(m_capacity) } {
+	link_slots();
+}
+
+template<class Base>
+timer_service<Base>::timer_service(base_clock &base, const std::size_t capacity)
+	: clock_ref{ base }
+	, m_capacity{ static_cast<u32>(std::clamp<std::size_t>(capacity, 1, no_slot - 1)) }
+	, m_slots{ std::make_unique<slot[]>(m_capacity) } {
+	link_slots();
+}
+
+template<class Base>
+timer_service<Base>::~timer_service() {
+	stop();
+}
+
+template<class Base>
+timer_handle timer_service<Base>::arm(const deadline_type deadline, callback &&task) {
+	const auto index{ acquire_slot() };
+	if (index == no_slot) [[unlikely]] {
+		m_rejected.value.fetch_add(1, std::memory_order_relaxed);
+		m_wakeup.notify_one(); // the sleeping owner frees slots of cancelled timers
+		return timer_handle{};
+	}
+
+	auto &target{ m_slots[index] };
+	const auto generation{ static_cast<u32>(target.state.load(std::memory_order_relaxed) >> status_bits) + 1 };
+	target.deadline = deadline.point();
+	target.task = std::move(task);
+	target.state.store(state_of(generation, armed), std::memory_order_relaxed);
+
+	/// The release part of the CAS publishes the slot contents to the owner
+	auto *head{ m_arms.load(std::memory_order_relaxed) };
+	do {
+		target.arm_next = head;
+	} while (!m_arms.compare_exchange_weak(head, &target, std::memory_order_seq_cst, std::memory_order_relaxed));
+	m_armed.value.fetch_add(1, std::memory_order_relaxed);
+
+	/// The owner either sees the request before sleeping or has published a later wake up time
+	if (deadline.point().time_since_epoch().count() < m_wake_at.load(std::memory_order_seq_cst)) {
+		m_wakeup.notify_one();
+	}
+	return timer_handle{ index, generation };
+}
+
+template<class Base>
+timer_handle timer_service<Base>::arm(const time interval, callback &&task) {
+	return arm(deadline_type{ clock_ref::now() + interval.duration() }, std::move(task));
+}
+
+template<class Base>
+template<class Rep, class Period>
+timer_handle timer_service<Base>::arm(const std::chrono::duration<Rep, Period> interval, callback &&task) {
+	return arm(time{ interval }, std::move(task));
+}
+
+template<class Base>
+bool timer_service<Base>::cancel(const timer_handle handle) noexcept {
+	if (handle.index >= m_capacity) return false;
+
+	auto expected{ state_of(handle.generation, armed) };
+	if (!m_slots[handle.index].state.compare_exchange_strong(expected, state_of(handle.generation, cancelled),
+		std::memory_order_acq_rel, std::memory_order_relaxed)) {
+		return false;
+	}
+	m_cancelled.value.fetch_add(1, std::memory_order_relaxed);
+	const auto unreleased{ m_unreleased.value.fetch_add(1, std::memory_order_relaxed) + 1 };
+	if (unreleased % compaction_threshold() == 0) {
+		m_wakeup.notify_one(); // the sleeping owner has to compact the heap to free the slots
+	}
+	return true;
+}
+
+template<class Base>
+std::size_t timer_service<Base>::poll() {
+	drain();
+	compact();
+
+	const auto now{ clock_ref::now() };
+	const auto limit{ now.time_since_epoch().count() };
+	std::size_t fired{};
+	while (!m_heap.empty() && m_heap.front().deadline <= limit) {
+		std::pop_heap(std::begin(m_heap), std::end(m_heap), later);
+		const auto index{ m_heap.back().index };
+		m_heap.pop_back();
+
+		auto &target{ m_slots[index] };
+		auto expected{ target.state.load(std::memory_order_relaxed) };
+		if ((expected & status_mask) == armed && target.state.compare_exchange_strong(expected,
+			(expected & ~status_mask) | firing, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+			lateness::record(now, target.deadline);
+			target.task();
+			++fired;
+		}
+		release_slot(index);
+	}
+	if (fired != 0) {
+		m_fired.value.fetch_add(fired, std::memory_order_relaxed);
+	}
+	return fired;
+}
+
+template<class Base>
+void timer_service<Base>::start() {
+	launch(any_core);
+}
+
+template<class Base>
+void timer_service<Base>::start(const u32 core) {
+	launch(core);
+}
+
+template<class Base>
+void timer_service<Base>::stop() {
+	if (!m_running.exchange(false, std::memory_order_acq_rel)) return;
+	m_wakeup.notify_all();
+	if (m_driver.joinable()) {
+		m_driver.join();
+	}
+}
+
+template<class Base>
+bool timer_service<Base>::running() const noexcept {
+	return m_running.load(std::memory_order_relaxed);
+}
+
+template<class Base>
+std::size_t timer_service<Base>::capacity() const noexcept {
+	return m_capacity;
+}
+
+template<class Base>
+timer_service_stats timer_service<Base>::stats() const noexcept {
+	return timer_service_stats{
+		m_armed.value.load(std::memory_order_relaxed),
+		m_fired.value.load(std::memory_order_relaxed),
+		m_cancelled.value.load(std::memory_order_relaxed),
+		m_rejected.value.load(std::memory_order_relaxed),
+		m_batches.load(std::memory_order_relaxed),
+		m_largest_batch.load(std::memory_order_relaxed),
+	};
+}
+
+template<class Base>
+void timer_service<Base>::link_slots() {
+	/// Slots are chained in order, so the first arms take the first slots
+	for (u32 index{}; index < m_capacity; ++index) {
+		m_slots[index].free_next.store(index + 1 < m_capacity ? index + 1 : no_slot, std::memory_order_relaxed);
+	}
+	m_free.store(0, std::memory_order_release);
+	m_heap.reserve(m_capacity);
+}
+
+template<class Base>
+u32 timer_service<Base>::acquire_slot() noexcept {
+	auto head{ m_free.load(std::memory_order_acquire) };
+	while (true) {
+		const auto index{ static_cast<u32>(head) };
+		if (index == no_slot) return no_slot;
+
+		/// The tag changes on every pop, so a stale `free_next` can't win the CAS (ABA)
+		const auto next{ m_slots[index].free_next.load(std::memory_order_relaxed) };
+		const auto replacement{ (((head >> 32) + 1) << 32) | next };
+		if (m_free.compare_exchange_weak(head, replacement, std::memory_order_acquire, std::memory_order_acquire)) {
+			return index;
+		}
+	}
+}
+
+template<class Base>
+void timer_service<Base>::release_slot(const u32 index) noexcept {
+	auto &target{ m_slots[index] };
+	target.task = nullptr;
+
+	const auto state{ target.state.load(std::memory_order_relaxed) };
+	if ((state & status_mask) == cancelled) {
+		m_unreleased.value.fetch_sub(1, std::memory_order_relaxed);
+	}
+	target.state.store(state & ~status_mask, std::memory_order_relaxed); // idle, the generation is kept
+
+	auto head{ m_free.load(std::memory_order_relaxed) };
+	do {
+		target.free_next.store(static_cast<u32>(head), std::memory_order_relaxed);
+	} while (!m_free.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | index,
+		std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<class Base>
+void timer_service<Base>::drain() {
+	auto *batch{ m_arms.exchange(nullptr, std::memory_order_acquire) };
+	if (batch == nullptr) return;
+
+	/// The list is LIFO, reversing it keeps timers with equal deadlines in the arm order
+	slot *ordered{};
+	u64 count{};
+	while (batch != nullptr) {
+		auto *next{ batch->arm_next };
+		batch->arm_next = ordered;
+		ordered = batch;
+		batch = next;
+		++count;
+	}
+
+	while (ordered != nullptr) {
+		/// The link is read first: a released slot could be armed and pushed again right away
+		auto *current{ std::exchange(ordered, ordered->arm_next) };
+		const auto index{ static_cast<u32>(current - m_slots.get()) };
+		if ((current->state.load(std::memory_order_acquire) & status_mask) == cancelled) {
+			release_slot(index);
+			continue;
+		}
+		m_heap.push_back(entry{ current->deadline.time_since_epoch().count(), m_order++, index });
+		std::push_heap(std::begin(m_heap), std::end(m_heap), later);
+	}
+
+	m_batches.fetch_add(1, std::memory_order_relaxed);
+	if (count > m_largest_batch.load(std::memory_order_relaxed)) {
+		m_largest_batch.store(count, std::memory_order_relaxed);
+	}
+}
+
+template<class Base>
+void timer_service<Base>::compact() {
+	constexpr std::size_t min_size{ 64 };
+	const auto unreleased{ m_unreleased.value.load(std::memory_order_relaxed) };
+	if (unreleased < compaction_threshold() && (m_heap.size() < min_size || unreleased * 2 < m_heap.size())) return;
+
+	const auto removed{ std::remove_if(std::begin(m_heap), std::end(m_heap), [this](const entry &item) {
+		if ((m_slots[item.index].state.load(std::memory_order_acquire) & status_mask) != cancelled) return false;
+		release_slot(item.index);
+		return true;
+	}) };
+	m_heap.erase(removed, std::end(m_heap));
+	std::make_heap(std::begin(m_heap), std::end(m_heap), later);
+}
+
+template<class Base>
+void timer_service<Base>::drive() {
+	while (m_running.load(std::memory_order_acquire)) {
+		poll();
+
+		const auto wake_at{ m_heap.empty() ? std::numeric_limits<rep>::max() : m_heap.front().deadline };
+		m_wake_at.store(wake_at, std::memory_order_seq_cst);
+		const auto epoch{ m_wakeup.prepare() };
+		if (m_arms.load(std::memory_order_seq_cst) != nullptr || !m_running.load(std::memory_order_acquire)) {
+			m_wakeup.finish();
+			continue;
+		}
+
+		auto timeout{ std::chrono::nanoseconds::max() };
+		if (wake_at != std::numeric_limits<rep>::max()) {
+			timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				time_point{ typename time_point::duration{ wake_at } } - clock_ref::now());
+		}
+		m_wakeup.wait(epoch, timeout);
+		m_wakeup.finish();
+	}
+	m_wake_at.store(std::numeric_limits<rep>::max(), std::memory_order_relaxed);
+}
+
+template<class Base>
+void timer_service<Base>::launch(const u32 core) {
+	static_assert(utils::has_static_now_v<Base>,
+		"[golxzn::os::chrono::timer_service] The driver thread requires BaseClock with static now()");
+
+	if (m_running.exchange(true, std::memory_order_acq_rel)) return;
+	m_driver = std::thread([this, core] {
+		details::mark_timer_driver();
+		if (core != any_core) {
+			(void)details::pin_current_thread(core);
+		}
+		drive();
+	});
+}
+
+template<class Base>
+bool timer_service<Base>::later(const entry &lhs, const entry &rhs) noexcept {
+	if (lhs.deadline != rhs.deadline) return rhs.deadline < lhs.deadline;
+	return rhs.order < lhs.order;
+}
+
+template<class Base>
+u64 timer_service<Base>::compaction_threshold() const noexcept {
+	return std::max<u64>(m_capacity / 4, 1);
+}
+
+template<class Base>
+constexpr u64 timer_service<Base>::state_of(const u32 generation, const status value) noexcept {
+	return (u64{ generation } << status_bits) | value;
+}
+
+template<class Base>
+sharded_timer_service<Base>::sharded_timer_service(const std::size_t shards, const std::size_t capacity,
+	const timer_placement placement)
+	: m_placement{ placement } {
+	const auto available{ details::available_cores() };
+	const auto count{ shards != 0 ? shards : available.size() };
+
+	m_cores.resize(count);
+	for (std::size_t shard{}; shard < count; ++shard) {
+		m_cores[shard] = available[shard % available.size()];
+	}
+
+	/// Cores without their own shard (more cores than shards) share them round-robin
+	m_shard_of_core.resize(std::size_t{ *std::max_element(std::begin(available), std::end(available)) } + 1);
+	for (std::size_t core{}; core < m_shard_of_core.size(); ++core) {
+		m_shard_of_core[core] = static_cast<u32>(core % count);
+	}
+	for (std::size_t shard{}; shard < std::min(count, available.size()); ++shard) {
+		m_shard_of_core[m_cores[shard]] = static_cast<u32>(shard);
+	}
+
+	m_shards.reserve(count);
+	for (std::size_t shard{}; shard < count; ++shard) {
+		m_shards.push_back(std::make_unique<shard_type>(capacity));
+		m_shards.back()->start(m_cores[shard]);
+	}
+}
+
+template<class Base>
+sharded_timer_service<Base>::~sharded_timer_service() {
+	for (auto &shard : m_shards) {
+		shard->stop();
+	}
+}
+
+template<class Base>
+timer_handle sharded_timer_service<Base>::arm(const deadline_type deadline, callback &&task) {
+	const auto local{ local_shard() };
+	const auto first{ target_shard(local) };
+
+	/// A full shard hands the timer to the next one, so only all shards being full rejects it
+	for (std::size_t attempt{}; attempt < m_shards.size(); ++attempt) {
+		const auto shard{ (first + attempt) % m_shards.size() };
+		if (const auto handle{ arm_at(shard, deadline, task) }; handle.valid()) [[likely]] {
+			if (shard != local) {
+				m_migrated.fetch_add(1, std::memory_order_relaxed);
+			}
+			return handle;
+		}
+	}
+	return timer_handle{};
+}
+
+template<class Base>
+timer_handle sharded_timer_service<Base>::arm(const time interval, callback &&task) {
+	return arm(deadline_type{ base_clock::now() + interval.duration() }, std::move(task));
+}
+
+template<class Base>
+template<class Rep, class Period>
+timer_handle sharded_timer_service<Base>::arm(const std::chrono::duration<Rep, Period> interval, callback &&task) {
+	return arm(time{ interval }, std::move(task));
+}
+
+template<class Base>
+timer_handle sharded_timer_service<Base>::arm_on(const std::size_t shard, const deadline_type deadline, callback &&task) {
+	if (shard >= m_shards.size()) return timer_handle{};
+	return arm_at(shard, deadline, task);
+}
+
+template<class Base>
+bool sharded_timer_service<Base>::cancel(const timer_handle handle) noexcept {
+	if (handle.shard >= m_shards.size()) return false;
+	return m_shards[handle.shard]->cancel(handle);
+}
+
+template<class Base>
+std::size_t sharded_timer_service<Base>::shards() const noexcept {
+	return m_shards.size();
+}
+
+template<class Base>
+std::size_t sharded_timer_service<Base>::local_shard() const noexcept {
+	const auto core{ details::current_core() };
+	if (core < m_shard_of_core.size()) [[likely]] return m_shard_of_core[core];
+	return core % m_shards.size();
+}
+
+template<class Base>
+u32 sharded_timer_service<Base>::core(const std::size_t shard) const noexcept {
+	return shard < m_cores.size() ? m_cores[shard] : 0;
+}
+
+template<class Base>
+timer_placement sharded_timer_service<Base>::placement() const noexcept {
+	return m_placement;
+}
+
+template<class Base>
+u64 sharded_timer_service<Base>::migrated() const noexcept {
+	return m_migrated.load(std::memory_order_relaxed);
+}
+
+template<class Base>
+timer_service_stats sharded_timer_service<Base>::stats(const std::size_t shard) const noexcept {
+	if (shard >= m_shards.size()) return timer_service_stats{};
+	return m_shards[shard]->stats();
+}
+
+template<class Base>
+timer_service_stats sharded_timer_service<Base>::stats() const noexcept {
+	timer_service_stats total{};
+	for (const auto &shard : m_shards) {
+		const auto current{ shard->stats() };
+		total.armed += current.armed;
+		total.fired += current.fired;
+		total.cancelled += current.cancelled;
+		total.rejected += current.rejected;
+		total.batches += current.batches;
+		total.largest_batch = std::max(total.largest_batch, current.largest_batch);
+	}
+	return total;
+}
+
+template<class Base>
+std::size_t sharded_timer_service<Base>::target_shard(const std::size_t local) const noexcept {
+	if (m_placement != timer_placement::balanced) return local;
+
+	auto least{ local };
+	auto least_pending{ pending(local) };
+	const auto local_pending{ least_pending };
+	for (std::size_t shard{}; shard < m_shards.size(); ++shard) {
+		if (const auto current{ pending(shard) }; current < least_pending) {
+			least = shard;
+			least_pending = current;
+		}
+	}
+	/// Locality wins unless the local shard is clearly overloaded
+	return local_pending > migration_slack && local_pending > least_pending * 2 ? least : local;
+}
+
+template<class Base>
+u64 sharded_timer_service<Base>::pending(const std::size_t shard) const noexcept {
+	const auto current{ m_shards[shard]->stats() };
+	const auto finished{ current.fired + current.cancelled };
+	return current.armed > finished ? current.armed - finished : 0;
+}
+
+template<class Base>
+timer_handle sharded_timer_service<Base>::arm_at(const std::size_t shard, const deadline_type deadline, callback &task) {
+	/// timer_service::arm() takes the callback only when it gets a slot, so a rejected one could be retried
+	auto handle{ m_shards[shard]->arm(deadline, std::move(task)) };
+	if (handle.valid()) {
+		handle.shard = static_cast<u32>(shard);
+	}
+	return handle;
+}
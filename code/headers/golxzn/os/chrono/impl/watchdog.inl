@@ -0,0 +1,170 @@
+
+template<class Base>
+watchdog<Base>::worker::worker(watchdog *owner, slot *target) noexcept
+	: m_owner{ owner }, m_slot{ target } {}
+
+template<class Base>
+watchdog<Base>::worker::worker(worker &&other) noexcept
+	: m_owner{ std::exchange(other.m_owner, nullptr) }
+	, m_slot{ std::exchange(other.m_slot, nullptr) } {}
+
+template<class Base>
+typename watchdog<Base>::worker &watchdog<Base>::worker::operator=(worker &&other) noexcept {
+	if (this != &other) {
+		if (valid()) m_owner->remove(m_slot);
+		m_owner = std::exchange(other.m_owner, nullptr);
+		m_slot = std::exchange(other.m_slot, nullptr);
+	}
+	return *this;
+}
+
+template<class Base>
+watchdog<Base>::worker::~worker() {
+	if (valid()) m_owner->remove(m_slot);
+}
+
+template<class Base>
+void watchdog<Base>::worker::heartbeat() const noexcept {
+	m_slot->last_beat.store(m_owner->m_cached_now.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+template<class Base>
+bool watchdog<Base>::worker::valid() const noexcept {
+	return m_owner != nullptr && m_slot != nullptr;
+}
+
+
+template<class Base>
+watchdog<Base>::watchdog(const time threshold, stall_handler &&handler, const time scan_interval)
+	: m_threshold{ threshold }
+	, m_scan_interval{ scan_interval > time::zero()
+		? scan_interval
+		: time{ std::max(threshold.microseconds() / 4, i64{ 1 }) } }
+	, m_handler{ std::move(handler) }
+	, m_cached_now{ current() } {}
+
+template<class Base>
+watchdog<Base>::watchdog(base_clock &base, const time threshold, stall_handler &&handler, const time scan_interval)
+	: clock_ref{ base }
+	, m_threshold{ threshold }
+	, m_scan_interval{ scan_interval > time::zero()
+		? scan_interval
+		: time{ std::max(threshold.microseconds() / 4, i64{ 1 }) } }
+	, m_handler{ std::move(handler) }
+	, m_cached_now{ current() } {}
+
+template<class Base>
+watchdog<Base>::~watchdog() {
+#if defined(GOLXZN_MULTITHREADING)
+	stop();
+#endif // defined(GOLXZN_MULTITHREADING)
+}
+
+template<class Base>
+typename watchdog<Base>::worker watchdog<Base>::add(std::string name) {
+	std::lock_guard lock{ m_slots_mutex };
+	slot *target{};
+	if (m_free_slots.empty()) {
+		target = &m_slots.emplace_back();
+	} else {
+		target = m_free_slots.back();
+		m_free_slots.pop_back();
+	}
+	target->name = std::move(name);
+	target->reported = false;
+	target->last_beat.store(current(), std::memory_order_relaxed);
+	target->active.store(true, std::memory_order_release);
+	return worker{ this, target };
+}
+
+template<class Base>
+std::size_t watchdog<Base>::scan() {
+	const auto now{ current() };
+	m_cached_now.store(now, std::memory_order_relaxed);
+
+	std::size_t stalled_count{};
+	std::vector<std::pair<std::string, time>> stalled;
+	{
+		std::lock_guard lock{ m_slots_mutex };
+		for (auto &target : m_slots) {
+			if (!target.active.load(std::memory_order_acquire)) continue;
+
+			const auto last{ target.last_beat.load(std::memory_order_relaxed) };
+			const time silent{ now - last };
+			if (silent <= m_threshold) {
+				target.reported = false;
+				continue;
+			}
+
+			++stalled_count;
+			if (target.reported && target.reported_beat == last) continue;
+
+			target.reported = true;
+			target.reported_beat = last;
+			stalled.emplace_back(target.name, silent);
+		}
+	}
+
+	for (const auto &[name, silent] : stalled) {
+		m_handler(name, silent);
+	}
+	return stalled_count;
+}
+
+template<class Base>
+time watchdog<Base>::scan_interval() const noexcept {
+	return m_scan_interval;
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+template<class Base>
+void watchdog<Base>::start() {
+	std::lock_guard lock{ m_monitor_mutex };
+	if (m_monitor_running) return;
+
+	m_monitor_running = true;
+	m_monitor = std::thread([this] {
+		std::unique_lock lock{ m_monitor_mutex };
+		while (m_monitor_running) {
+			const auto next{ [this] {
+				if constexpr (utils::has_static_now_v<Base>) {
+					return fast_timer<Base>{ m_scan_interval };
+				} else {
+					return fast_timer<Base>{ clock_ref::base(), m_scan_interval };
+				}
+			}() };
+
+			lock.unlock();
+			scan();
+			lock.lock();
+
+			m_monitor_wakeup.wait_for(lock, next.time_left().duration(), [this] { return !m_monitor_running; });
+		}
+	});
+}
+
+template<class Base>
+void watchdog<Base>::stop() {
+	{
+		std::lock_guard lock{ m_monitor_mutex };
+		m_monitor_running = false;
+	}
+	m_monitor_wakeup.notify_all();
+	if (m_monitor.joinable()) {
+		m_monitor.join();
+	}
+}
+#endif // defined(GOLXZN_MULTITHREADING)
+
+template<class Base>
+i64 watchdog<Base>::current() const noexcept {
+	return utils::difference<time>(clock_ref::now(), time_point{}).microseconds();
+}
+
+template<class Base>
+void watchdog<Base>::remove(slot *target) {
+	std::lock_guard lock{ m_slots_mutex };
+	target->active.store(false, std::memory_order_release);
+	m_free_slots.push_back(target);
+}
+
@@ -0,0 +1,137 @@
+/**
+ * @file golxzn/os/chrono/lateness.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Fixed memory histogram of timers' lateness
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Lock-free histogram of microsecond durations with fixed memory.
+ * @ingroup Chrono lateness
+ * @details Values are put into log-linear buckets: each power of two is split into 16 sub-buckets,
+ * so the relative error of percentiles is less than 6.25%. Values below 16us are exact, and values above
+ * 2^41us (~25 days) are put into the last bucket. Recording is a few relaxed atomic operations and
+ * could be done from any thread.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::lateness_histogram histogram;
+ * histogram.record(golxzn::os::chrono::microseconds(130));
+ * const auto p99{ histogram.percentile(0.99) };
+ * @endcode
+ */
+class lateness_histogram {
+public:
+	static constexpr std::size_t sub_bucket_bits{ 4 };                        ///< log2 of sub-buckets per power of two
+	static constexpr std::size_t sub_buckets{ std::size_t{ 1 } << sub_bucket_bits }; ///< Sub-buckets per power of two
+	static constexpr std::size_t max_exponent{ 41 };                          ///< Largest tracked power of two
+	static constexpr std::size_t buckets_count{ (max_exponent - sub_bucket_bits + 2) * sub_buckets }; ///< Number of buckets
+
+	lateness_histogram() noexcept = default;
+	lateness_histogram(const lateness_histogram &) = delete;
+	lateness_histogram &operator=(const lateness_histogram &) = delete;
+
+	/**
+	 * @brief Records the value. Negative values (early calls) are recorded as zero.
+	 */
+	void record(const time value) noexcept;
+
+	/**
+	 * @brief Returns number of recorded values.
+	 */
+	[[nodiscard]] u64 count() const noexcept;
+
+	/**
+	 * @brief Returns upper bound of the bucket which contains the given quantile.
+	 * @param quantile Quantile in [0, 1] range (e.g. 0.99 for p99).
+	 * @return Zero if there're no values.
+	 */
+	[[nodiscard]] time percentile(const f64 quantile) const noexcept;
+
+	/**
+	 * @brief Returns the exact largest recorded value.
+	 */
+	[[nodiscard]] time max() const noexcept;
+
+	/**
+	 * @brief Returns the exact mean of recorded values.
+	 */
+	[[nodiscard]] time mean() const noexcept;
+
+	/**
+	 * @brief Returns the exact sum of recorded values.
+	 */
+	[[nodiscard]] time sum() const noexcept;
+
+	/**
+	 * @brief Returns number of values in the bucket.
+	 * @see bucket_of(const u64 microseconds)
+	 */
+	[[nodiscard]] u64 bucket_count(const std::size_t bucket) const noexcept;
+
+	/**
+	 * @brief Forgets all recorded values. Values recorded concurrently could be lost.
+	 */
+	void reset() noexcept;
+
+	/**
+	 * @brief Returns bucket index of the value in microseconds.
+	 */
+	[[nodiscard]] static constexpr std::size_t bucket_of(const u64 microseconds) noexcept;
+
+	/**
+	 * @brief Returns the largest value in microseconds which is put into the bucket.
+	 */
+	[[nodiscard]] static constexpr u64 bucket_upper_bound(const std::size_t bucket) noexcept;
+
+private:
+	std::array<std::atomic<u64>, buckets_count> m_buckets{};
+	std::atomic<u64> m_count{};
+	std::atomic<u64> m_sum{};
+	std::atomic<u64> m_max{};
+};
+
+namespace lateness {
+
+/**
+ * @brief Sets histogram which receives lateness of every timer dispatch.
+ * @ingroup Chrono lateness
+ * @details Lateness is `now - deadline` measured right before calling the callback. It's recorded
+ * once per dispatch by golxzn::os::chrono::timer_service (so also by golxzn::os::chrono::timer on clocks with
+ * static `now()`), golxzn::os::chrono::timer (thread and clock dispatch, or `update()` without `GOLXZN_MULTITHREADING`)
+ * and golxzn::os::chrono::periodic_scheduler. When there's no sink, the cost is a single atomic load.
+ * @warning The histogram has to outlive all dispatches which could see it.
+ * @param histogram Histogram or nullptr to disable recording.
+ */
+void set_sink(lateness_histogram *histogram) noexcept;
+
+/**
+ * @brief Returns current lateness sink or nullptr.
+ * @ingroup Chrono lateness
+ */
+[[nodiscard]] lateness_histogram *sink() noexcept;
+
+/**
+ * @brief Records `now - deadline` into the current sink if it's set.
+ * @ingroup Chrono lateness
+ */
+template<class TimePoint>
+void record(const TimePoint now, const TimePoint deadline) noexcept;
+
+} // namespace lateness
+
+#include "golxzn/os/chrono/impl/lateness.inl"
+
+} // namespace golxzn::os::chrono
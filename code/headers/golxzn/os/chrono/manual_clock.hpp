@@ -0,0 +1,133 @@
+/**
+ * @file golxzn/os/chrono/manual_clock.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Deterministic clock which is advanced explicitly
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Stateful base clock which time moves only when it's advanced.
+ * @ingroup Chrono clocks
+ * @details It's intended for simulations and tests. Clocks and timers take its instance in the constructor.
+ * Timers hand their callbacks to the clock (see golxzn::os::chrono::utils::has_scheduler), so callbacks
+ * are called by `advance()` in the deadline order on the calling thread. Thus hours of timer behaviour
+ * could be simulated without sleeping at all.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::manual_clock virtual_time;
+ * golxzn::os::chrono::timer timer{ virtual_time, 10min, [] { std::puts("Done!"); } };
+ * golxzn::os::chrono::fast_clock clock{ virtual_time };
+ *
+ * virtual_time.advance(1h); // "Done!" is printed here
+ * assert(clock.elapsed() == 1h);
+ * @endcode
+ */
+class manual_clock {
+public:
+	using rep = i64;                                          ///< Representation type
+	using period = std::nano;                                 ///< Tick period
+	using duration = std::chrono::duration<rep, period>;      ///< Duration type
+	using time_point = std::chrono::time_point<manual_clock>; ///< Time point type
+	using task_id = u64;                                      ///< Scheduled task identifier
+	using task = std::function<void()>;                       ///< Scheduled task type
+
+	static constexpr bool is_steady{ true };
+	static constexpr task_id invalid_task{};
+
+	/**
+	 * @brief Constructs manual clock.
+	 * @param start Initial time point.
+	 */
+	explicit manual_clock(const time_point start = time_point{}) noexcept;
+
+	manual_clock(const manual_clock &) = delete;
+	manual_clock &operator=(const manual_clock &) = delete;
+
+	/**
+	 * @brief Returns current virtual time. Could be called from any thread.
+	 */
+	[[nodiscard]] time_point now() const noexcept;
+
+	/**
+	 * @brief Moves time forward by step calling all tasks which deadlines are reached.
+	 * @details Every task is called after time is set to its deadline, so tasks observe
+	 * their own deadline as `now()`. Tasks could schedule and cancel other tasks.
+	 * @param step Time step. Negative steps are ignored.
+	 * @return Number of called tasks.
+	 */
+	std::size_t advance(const time step);
+
+	/**
+	 * @brief Moves time forward by step calling all tasks which deadlines are reached.
+	 * @see advance(const time step)
+	 */
+	template<class Rep, class Period>
+	std::size_t advance(const std::chrono::duration<Rep, Period> step);
+
+	/**
+	 * @brief Moves time forward to the time point calling all tasks which deadlines are reached.
+	 * @details If the time point is in the past, only overdue tasks are called.
+	 * @param point Target time point.
+	 * @return Number of called tasks.
+	 */
+	std::size_t advance_to(const time_point point);
+
+	/**
+	 * @brief Schedules task to be called when time reaches the deadline.
+	 * @details Tasks with deadline in the past are called on the next `advance()`.
+	 * Tasks with equal deadlines are called in the order they've been scheduled.
+	 * @param deadline Time point when task has to be called.
+	 * @param callback Task.
+	 * @return Task identifier which could be used to cancel the task.
+	 */
+	task_id schedule(const time_point deadline, task &&callback);
+
+	/**
+	 * @brief Cancels scheduled task.
+	 * @param id Task identifier.
+	 * @return true if task was pending and now it's cancelled.
+	 */
+	bool cancel(const task_id id);
+
+	/**
+	 * @brief Returns number of pending tasks.
+	 */
+	[[nodiscard]] std::size_t pending() const;
+
+private:
+	using task_key = std::pair<time_point, task_id>;
+
+	std::atomic<time_point> m_now;
+	mutable std::mutex m_tasks_mutex;
+	std::map<task_key, task> m_tasks;
+	std::unordered_map<task_id, time_point> m_deadlines;
+	task_id m_last_id{ invalid_task };
+};
+
+/**
+ * @brief Alias of golxzn::os::chrono::manual_clock
+ * @ingroup Chrono clocks
+ */
+using virtual_clock = manual_clock;
+
+template<class Rep, class Period>
+std::size_t manual_clock::advance(const std::chrono::duration<Rep, Period> step) {
+	return advance(time{ step });
+}
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,182 @@
+/**
+ * @file golxzn/os/chrono/meter.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Lock-free meters of the current latency
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <cmath>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Exponentially weighted moving average of time samples which decays with the elapsed time.
+ * @ingroup Chrono meters
+ * @details Samples are weighted by `exp(-age / tau)`, where age is the time since the sample
+ * and `tau = half_life / ln(2)`, so the result doesn't depend on how often samples arrive.
+ * The meter keeps decayed sum and weight of samples; every record claims the time elapsed since
+ * the previous one with CAS and decays both by it. Simultaneous samples have equal weights.
+ * `value()` is two relaxed loads and a division.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::ewma_meter<> latency{ golxzn::os::chrono::milliseconds(500) };
+ * latency.record(request_clock.elapsed());
+ * if (latency.value() > golxzn::os::chrono::milliseconds(200)) shed();
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class ewma_meter : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::ewma_meter] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::ewma_meter] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+
+	/**
+	 * @brief Constructs meter.
+	 * @param half_life Time after which sample's weight is halved.
+	 */
+	explicit ewma_meter(const time half_life) noexcept;
+
+	/**
+	 * @brief Constructs meter which uses the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this meter.
+	 */
+	ewma_meter(base_clock &base, const time half_life) noexcept;
+
+	ewma_meter(const ewma_meter &) = delete;
+	ewma_meter &operator=(const ewma_meter &) = delete;
+
+	/**
+	 * @brief Adds sample. Lock-free, could be called from any thread.
+	 */
+	void record(const time sample) noexcept;
+
+	/**
+	 * @brief Returns current average or zero if there were no samples.
+	 */
+	[[nodiscard]] time value() const noexcept;
+
+	/**
+	 * @brief Returns half life of samples.
+	 */
+	[[nodiscard]] time half_life() const noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	const time m_half_life;
+	const f64 m_inverse_tau;
+	std::atomic<i64> m_last{};
+	std::atomic<f64> m_sum{};
+	std::atomic<f64> m_weight{};
+
+	[[nodiscard]] i64 current() const noexcept;
+	static void decay_and_add(std::atomic<f64> &target, const f64 decay, const f64 value) noexcept;
+};
+
+/**
+ * @brief Aggregated samples of golxzn::os::chrono::sliding_window_meter.
+ * @ingroup Chrono meters
+ */
+struct window_stats {
+	u64 count{}; ///< Number of samples in the window
+	time sum{};  ///< Sum of samples
+	time mean{}; ///< Mean of samples
+	time max{};  ///< Largest sample
+};
+
+/**
+ * @brief Aggregates time samples over the sliding window.
+ * @ingroup Chrono meters
+ * @details The window is a ring of buckets, each covers `window / buckets` of time. A record adds
+ * the sample to the bucket of the current interval with relaxed atomics, the first record
+ * in a new interval resets the bucket, so updates are O(1). Queries sum buckets which belong to the
+ * window, so they're O(buckets). Samples which race with bucket reset could be lost.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::sliding_window_meter<> latency{ golxzn::os::chrono::milliseconds(1000), 10 };
+ * latency.record(request_clock.elapsed());
+ * if (latency.stats().max > golxzn::os::chrono::milliseconds(500)) shed();
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class sliding_window_meter : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::sliding_window_meter] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::sliding_window_meter] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+
+	/**
+	 * @brief Constructs meter.
+	 * @param window Window duration.
+	 * @param buckets Number of buckets. Window is moved by `window / buckets` steps.
+	 */
+	sliding_window_meter(const time window, const std::size_t buckets);
+
+	/**
+	 * @brief Constructs meter which uses the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this meter.
+	 */
+	sliding_window_meter(base_clock &base, const time window, const std::size_t buckets);
+
+	sliding_window_meter(const sliding_window_meter &) = delete;
+	sliding_window_meter &operator=(const sliding_window_meter &) = delete;
+
+	/**
+	 * @brief Adds sample. Lock-free, could be called from any thread.
+	 */
+	void record(const time sample) noexcept;
+
+	/**
+	 * @brief Returns aggregated samples of the window.
+	 */
+	[[nodiscard]] window_stats stats() const noexcept;
+
+	/**
+	 * @brief Returns window duration.
+	 */
+	[[nodiscard]] time window() const noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	struct alignas(64) bucket {
+		std::atomic<i64> epoch{ -1 };
+		std::atomic<u64> count{};
+		std::atomic<u64> sum{};
+		std::atomic<u64> max{};
+	};
+
+	const i64 m_width;
+	std::vector<bucket> m_buckets;
+
+	[[nodiscard]] i64 current_epoch() const noexcept;
+};
+
+#include "golxzn/os/chrono/impl/meter.inl"
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,188 @@
+/**
+ * @file golxzn/os/chrono/openmetrics.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief OpenMetrics (Prometheus text format) exporter of timing statistics
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/meter.hpp"
+#include "golxzn/os/chrono/lateness.hpp"
+#include "golxzn/os/chrono/timer_service.hpp"
+
+namespace golxzn::os::chrono::openmetrics {
+
+/**
+ * @brief Formats metrics in the OpenMetrics text exposition format.
+ * @ingroup Chrono openmetrics
+ * @details Metrics are appended to the internal buffer. `clear()` keeps its capacity, so after the first
+ * scrape formatting doesn't allocate. Numbers are formatted without locale, and time values are exported
+ * in seconds with microsecond precision, as OpenMetrics recommends.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::openmetrics::writer writer;
+ * writer.histogram("timer_lateness_seconds", lateness, "Timer callback lateness");
+ * writer.gauge("request_latency_seconds", request_ewma, "Smoothed request latency");
+ * writer.finish();
+ * writer.write_file("/var/lib/node_exporter/chrono.prom");
+ * writer.clear();
+ * @endcode
+ */
+class writer {
+public:
+	static constexpr std::string_view content_type{ "application/openmetrics-text; version=1.0.0; charset=utf-8" };
+
+	writer() = default;
+
+	/**
+	 * @brief Exports histogram with power of two bucket bounds (15us, 31us, 63us, ...).
+	 * @details Bounds are the same for every scrape, so the histogram could be aggregated.
+	 */
+	void histogram(std::string_view name, const lateness_histogram &values, std::string_view help = {});
+
+	/**
+	 * @brief Exports current value of the EWMA meter as gauge in seconds.
+	 */
+	template<class BaseClock>
+	void gauge(std::string_view name, const ewma_meter<BaseClock> &meter, std::string_view help = {});
+
+	/**
+	 * @brief Exports window of the meter as `_window_count`, `_window_sum` and `_max` gauges, sum and max in seconds.
+	 * @details They aren't exported as summary, because values of the window go down as it slides.
+	 */
+	template<class BaseClock>
+	void window(std::string_view name, const sliding_window_meter<BaseClock> &meter, std::string_view help = {});
+
+	/**
+	 * @brief Exports time as gauge in seconds.
+	 */
+	void gauge(std::string_view name, const time value, std::string_view help = {});
+
+	/**
+	 * @brief Exports arbitrary gauge.
+	 */
+	void gauge(std::string_view name, const f64 value, std::string_view help = {});
+
+	/**
+	 * @brief Exports counter. `_total` suffix is appended to the sample name.
+	 */
+	void counter(std::string_view name, const u64 value, std::string_view help = {});
+
+#if defined(GOLXZN_MULTITHREADING)
+	/**
+	 * @brief Exports statistics of golxzn::os::chrono::timer_service or golxzn::os::chrono::sharded_timer_service.
+	 * (only when GOLXZN_MULTITHREADING is defined)
+	 * @details Armed, fired, cancelled and rejected timers and drained batches are `<name>_armed_total`, ...
+	 * counters, the largest batch is `<name>_largest_batch` gauge.
+	 */
+	void counters(std::string_view name, const timer_service_stats &stats);
+#endif // defined(GOLXZN_MULTITHREADING)
+
+	/**
+	 * @brief Appends the mandatory `# EOF` terminator.
+	 */
+	void finish();
+
+	/**
+	 * @brief Forgets formatted text keeping the buffer capacity.
+	 */
+	void clear() noexcept;
+
+	/**
+	 * @brief Returns formatted text.
+	 */
+	[[nodiscard]] std::string_view text() const noexcept;
+
+	/**
+	 * @brief Writes formatted text to the temporary file and renames it to the path,
+	 * so readers never see partially written files.
+	 * @return false if the file couldn't be written.
+	 */
+	bool write_file(const std::string &path) const;
+
+private:
+	std::string m_buffer;
+
+	void family(std::string_view name, std::string_view suffix, std::string_view type, std::string_view help);
+	void sample(std::string_view name, std::string_view suffix, std::string_view labels = {});
+	void append(const u64 value);
+	void append(const f64 value);
+	void append_seconds(const i64 microseconds);
+};
+
+#if defined(GOLXZN_MULTITHREADING)
+/**
+ * @brief Tiny HTTP server which serves metrics on localhost. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono openmetrics
+ * @details Listens on 127.0.0.1 only and answers every request with metrics formatted by the collector.
+ * Requests are served one by one on the server thread with a single reused writer.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::openmetrics::server server{ 9464, [&](auto &writer) {
+ * 	writer.histogram("timer_lateness_seconds", lateness);
+ * } };
+ * server.start();
+ * @endcode
+ */
+class server {
+public:
+	using collector = std::function<void(writer &)>; ///< Function which fills metrics
+
+	/**
+	 * @brief Constructs server.
+	 * @param port Local port. Zero means any free port (see port()).
+	 * @param collect Function which fills metrics for every request.
+	 */
+	server(const u16 port, collector &&collect);
+	server(const server &) = delete;
+	server &operator=(const server &) = delete;
+	~server();
+
+	/**
+	 * @brief Binds the port and starts the server thread.
+	 * @return false if the port couldn't be bound.
+	 */
+	bool start();
+
+	/**
+	 * @brief Stops the server thread and closes the port.
+	 */
+	void stop();
+
+	/**
+	 * @brief Returns the bound port.
+	 */
+	[[nodiscard]] u16 port() const noexcept;
+
+private:
+	u16 m_port;
+	const collector m_collect;
+	std::mutex m_mutex;
+	std::atomic<bool> m_running{};
+	std::thread m_thread;
+	std::intptr_t m_socket{ -1 };
+
+	void serve();
+};
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/impl/openmetrics.inl"
+
+} // namespace golxzn::os::chrono::openmetrics
@@ -0,0 +1,149 @@
+/**
+ * @file golxzn/os/chrono/perf.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Hardware performance counters measured together with time
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+namespace perf {
+
+/**
+ * @brief Hardware counters of the calling thread.
+ * @ingroup Chrono perf
+ */
+struct counters {
+	u64 cycles{};        ///< CPU cycles
+	u64 instructions{};  ///< Retired instructions
+	u64 cache_misses{};  ///< Last level cache misses
+	u64 branch_misses{}; ///< Mispredicted branches
+};
+
+/**
+ * @brief Returns true if hardware counters could be read on the calling thread.
+ * @ingroup Chrono perf
+ * @details Counters are opened with `perf_event_open` once per thread on first use. It's Linux only
+ * and it's usually unavailable in containers or when `kernel.perf_event_paranoid` forbids it.
+ */
+[[nodiscard]] bool available() noexcept;
+
+/**
+ * @brief Returns true if counters are read with `rdpmc` instruction without a syscall.
+ * @ingroup Chrono perf
+ */
+[[nodiscard]] bool user_space_reads() noexcept;
+
+/**
+ * @brief Reads hardware counters of the calling thread.
+ * @ingroup Chrono perf
+ * @param out Counters. Unsupported counters are left zero.
+ * @return false if counters are unavailable.
+ */
+bool read(counters &out) noexcept;
+
+} // namespace perf
+
+/**
+ * @brief Elapsed time and hardware counters of a measured region.
+ * @ingroup Chrono perf
+ */
+struct perf_sample {
+	time elapsed{};           ///< Elapsed time
+	perf::counters counters{}; ///< Counters delta. Zero if counters_valid is false
+	bool counters_valid{};    ///< false if hardware counters are unavailable
+
+	/**
+	 * @brief Instructions per cycle or zero if there's no counters.
+	 */
+	[[nodiscard]] f64 ipc() const noexcept;
+};
+
+/**
+ * @brief Clock which measures elapsed time together with hardware counters of the calling thread.
+ * @ingroup Chrono perf
+ * @details Works like golxzn::os::chrono::fast_clock, but `elapsed()` returns golxzn::os::chrono::perf_sample.
+ * When perf events are unavailable it degrades to time only measurement.
+ * @warning Counters are per thread, so the clock has to be used on the thread where it was created.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::perf_clock<> clock;
+ * parse(payload);
+ * const auto sample{ clock.elapsed() };
+ * std::cout << sample.elapsed.microseconds() << "us, IPC: " << sample.ipc() << '\n';
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class perf_clock : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::perf_clock] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::perf_clock] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Time point type from base clock
+
+	perf_clock() noexcept;
+
+	/**
+	 * @brief Constructs clock which measures time of the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this clock.
+	 * @param base base clock instance
+	 */
+	explicit perf_clock(base_clock &base) noexcept;
+
+	/**
+	 * @brief Returns elapsed time and counters since last call of `elapsed()` or since construction.
+	 */
+	[[nodiscard]] perf_sample elapsed() noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	perf::counters m_last_counters{};
+	bool m_counters_valid{};
+	time_point m_last_time{};
+};
+
+/**
+ * @brief Measures the scope and writes result on destruction.
+ * @ingroup Chrono perf
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::perf_sample sample;
+ * {
+ * 	golxzn::os::chrono::perf_scope<> scope{ sample };
+ * 	hot_path();
+ * }
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class perf_scope {
+public:
+	explicit perf_scope(perf_sample &out) noexcept;
+	perf_scope(BaseClock &base, perf_sample &out) noexcept;
+	perf_scope(const perf_scope &) = delete;
+	perf_scope &operator=(const perf_scope &) = delete;
+	~perf_scope();
+
+private:
+	perf_sample &m_out;
+	perf_clock<BaseClock> m_clock;
+};
+
+#include "golxzn/os/chrono/impl/perf.inl"
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,185 @@
+/**
+ * @file golxzn/os/chrono/periodic_scheduler.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Periodic jobs scheduler which spreads jobs' phases over their period
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <set>
+#include <mutex>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <thread>
+#include <condition_variable>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/deadline.hpp"
+#include "golxzn/os/chrono/lateness.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Calls many periodic jobs avoiding the thundering herd.
+ * @ingroup Chrono periodic_scheduler
+ * @details Each job fires on its own grid: `epoch + phase + k * period`, where phase is a deterministic
+ * hash of the job key modulo period. So jobs with the same period are spread evenly over the period instead
+ * of firing in the same tick, and a job keeps its phase across restarts. Late ticks don't cause bursts:
+ * a job fires once and continues from the next grid point after now.
+ *
+ * Jobs are kept in an ordered set by their next fire time, so adding, removing and changing period
+ * costs O(log n), and a tick costs O(log n) per fired job. `tick()` returns the number of fired jobs,
+ * so the load curve could be checked directly. Jobs are called without the lock held, so they could add,
+ * remove and reschedule jobs.
+ *
+ * If `GOLXZN_MULTITHREADING` is defined, `start()` runs the thread which sleeps until the nearest job.
+ * Otherwise (or with stateful clocks like golxzn::os::chrono::manual_clock) `tick()` has to be called manually.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::periodic_scheduler<> scheduler;
+ * for (const auto &host : hosts) {
+ * 	scheduler.add(host.name, golxzn::os::chrono::time{ 30s }, [&host] { host.check(); });
+ * }
+ * scheduler.on_tick([](auto, std::size_t fired) { fired_per_tick.record(fired); });
+ * scheduler.start();
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class periodic_scheduler : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::periodic_scheduler] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::periodic_scheduler] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+	using job_id = u64;                                 ///< Job identifier
+	using job = std::function<void()>;                  ///< Job type
+	using tick_observer = std::function<void(time_point now, std::size_t fired)>; ///< Tick callback type
+
+	static constexpr job_id invalid_job{};
+
+	periodic_scheduler() = default;
+
+	/**
+	 * @brief Constructs scheduler which uses the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this scheduler.
+	 * @param base base clock instance
+	 */
+	explicit periodic_scheduler(base_clock &base) noexcept;
+
+	periodic_scheduler(const periodic_scheduler &) = delete;
+	periodic_scheduler &operator=(const periodic_scheduler &) = delete;
+	~periodic_scheduler();
+
+	/**
+	 * @brief Adds periodic job which phase is derived from the key.
+	 * @param key Stable job key (e.g. host name). Jobs with the same key and period have the same phase.
+	 * @param period Job period. Has to be positive.
+	 * @param callback Job function.
+	 * @return Job identifier or invalid_job if period isn't positive.
+	 */
+	job_id add(std::string_view key, const time period, job &&callback);
+
+	/**
+	 * @brief Adds periodic job which phase is derived from its identifier.
+	 * @see add(std::string_view key, const time period, job &&callback)
+	 */
+	job_id add(const time period, job &&callback);
+
+	/**
+	 * @brief Removes job.
+	 * @return false if there's no such job.
+	 */
+	bool remove(const job_id id);
+
+	/**
+	 * @brief Changes job period. The phase is recalculated for the new period. O(log n).
+	 * @return false if there's no such job or period isn't positive.
+	 */
+	bool set_period(const job_id id, const time period);
+
+	/**
+	 * @brief Calls all jobs which fire time is reached.
+	 * @return Number of fired jobs.
+	 */
+	std::size_t tick();
+
+	/**
+	 * @brief Sets function which is called after every tick with the number of fired jobs.
+	 */
+	void on_tick(tick_observer &&observer);
+
+	/**
+	 * @brief Returns deadline of the nearest job or never if there're no jobs.
+	 */
+	[[nodiscard]] basic_deadline<BaseClock> next() const;
+
+	/**
+	 * @brief Returns number of jobs.
+	 */
+	[[nodiscard]] std::size_t size() const;
+
+#if defined(GOLXZN_MULTITHREADING)
+	/**
+	 * @brief Starts the thread which ticks when the nearest job is due. (only when GOLXZN_MULTITHREADING is defined)
+	 */
+	void start();
+
+	/**
+	 * @brief Stops ticking thread. (only when GOLXZN_MULTITHREADING is defined)
+	 */
+	void stop();
+#endif // defined(GOLXZN_MULTITHREADING)
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+	using queue_key = std::pair<i64, job_id>;
+
+	struct entry {
+		i64 period{};
+		u64 hash{};
+		i64 next{};
+		std::shared_ptr<job> callback;
+	};
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<job_id, entry> m_jobs;
+	std::set<queue_key> m_queue;
+	job_id m_last_id{ invalid_job };
+	std::shared_ptr<tick_observer> m_observer;
+
+#if defined(GOLXZN_MULTITHREADING)
+	std::condition_variable m_wakeup;
+	bool m_running{};
+	std::thread m_thread;
+#endif // defined(GOLXZN_MULTITHREADING)
+
+	[[nodiscard]] i64 current() const noexcept;
+	[[nodiscard]] time_point to_point(const i64 microseconds) const noexcept;
+	job_id insert(const bool keyed, const u64 key_hash, const time period, job &&callback);
+	void notify() noexcept;
+
+	[[nodiscard]] static i64 next_fire(const i64 now, const i64 period, const u64 seed) noexcept;
+	[[nodiscard]] static u64 hash(std::string_view key) noexcept;
+	[[nodiscard]] static u64 hash(const job_id id) noexcept;
+};
+
+#include "golxzn/os/chrono/impl/periodic_scheduler.inl"
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,132 @@
+/**
+ * @file golxzn/os/chrono/profiler.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Continuous per-thread call-tree profiler built on scoped timing
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <string_view>
+
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/clock.hpp"
+
+namespace golxzn::os::chrono::profiler {
+
+using site_id = u32; ///< Identifier of the profiled code site
+
+/**
+ * @brief Profiled code site. Intended to be a static variable.
+ * @ingroup Chrono profiler
+ * @details Registration takes a global lock, so sites have to be created once (e.g. as function-local statics)
+ * and then shared by all threads.
+ */
+class site {
+public:
+	/**
+	 * @brief Registers code site. Sites with the same name get the same identifier.
+	 */
+	explicit site(std::string_view name);
+
+	/**
+	 * @brief Returns site identifier.
+	 */
+	[[nodiscard]] site_id id() const noexcept;
+
+private:
+	site_id m_id;
+};
+
+/**
+ * @brief Measures the scope and accumulates it to the node of the calling thread's call tree.
+ * @ingroup Chrono profiler
+ * @details Each thread owns an arena of preallocated nodes. Entering a scope looks up the child of the current
+ * node by site id (a short walk over siblings) or takes the next arena node, so there's no allocation and no lock.
+ * Leaving the scope adds inclusive and exclusive time, the call and the maximum to the node with relaxed atomic
+ * stores, which are read by snapshots from other threads. If the arena is exhausted, new call paths
+ * and scopes nested into them aren't tracked, but are counted in golxzn::os::chrono::profiler::profile::dropped,
+ * and their time is still excluded from the exclusive time of the enclosing scope.
+ *
+ * Usage:
+ * @code{.cpp}
+ * void parse(std::string_view text) {
+ * 	static const golxzn::os::chrono::profiler::site parse_site{ "parse" };
+ * 	golxzn::os::chrono::profiler::scope scope{ parse_site };
+ * 	...
+ * }
+ *
+ * golxzn::os::chrono::profiler::snapshot().write_folded("profile.folded");
+ * @endcode
+ */
+class scope {
+public:
+	explicit scope(const site &where);
+	scope(const scope &) = delete;
+	scope &operator=(const scope &) = delete;
+	~scope();
+
+private:
+	u32 m_node;
+	fast_clock<> m_clock;
+};
+
+/**
+ * @brief Accumulated statistics of one call path merged across threads.
+ * @ingroup Chrono profiler
+ */
+struct call_path {
+	std::vector<site_id> sites; ///< Sites from the outermost to the innermost
+	u64 calls{};                ///< Number of calls
+	time inclusive{};           ///< Total time including nested scopes
+	time exclusive{};           ///< Total time excluding nested scopes
+	time max{};                 ///< The longest single call (inclusive)
+};
+
+/**
+ * @brief Merged call tree of all threads.
+ * @ingroup Chrono profiler
+ * @details Values are cumulative since the start of the program, so periodic snapshots could be diffed.
+ */
+struct profile {
+	std::vector<call_path> paths; ///< Call paths in depth-first order
+	u64 dropped{};                ///< Scopes which weren't tracked because arenas were exhausted
+
+	/**
+	 * @brief Returns folded stacks (`outer;inner <exclusive microseconds>` per line) for flamegraph tools.
+	 */
+	[[nodiscard]] std::string folded() const;
+
+	/**
+	 * @brief Writes folded stacks to the file.
+	 * @return false if the file couldn't be written.
+	 */
+	bool write_folded(const std::string &path) const;
+};
+
+/**
+ * @brief Sets number of nodes in arenas of threads which haven't profiled anything yet.
+ * @ingroup Chrono profiler
+ * @details Default is 4096 nodes.
+ */
+void set_arena_capacity(const std::size_t nodes) noexcept;
+
+/**
+ * @brief Returns site name by identifier.
+ * @ingroup Chrono profiler
+ */
+[[nodiscard]] std::string site_name(const site_id id);
+
+/**
+ * @brief Merges call trees of all threads which have ever profiled.
+ * @ingroup Chrono profiler
+ * @details Profiled threads aren't stopped or locked: nodes are published with release stores
+ * and counters are read with relaxed loads. Trees of exited threads are kept.
+ */
+[[nodiscard]] profile snapshot();
+
+} // namespace golxzn::os::chrono::profiler
@@ -0,0 +1,221 @@
+/**
+ * @file golxzn/os/chrono/replay_clock.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Recording and replaying of clock reads for deterministic reproductions
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/utils.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Per-thread logs of clock reads.
+ * @ingroup Chrono clocks
+ * @details Each thread appends to its own stream, which is preallocated on the first read, so recording
+ * takes neither a lock nor an allocation. Values are nanoseconds stored as zigzag varint deltas, which
+ * takes two or three bytes per read for usual call rates. If a stream is full, further reads of the thread
+ * aren't recorded and the stream is marked as truncated.
+ *
+ * Streams are numbered in the order threads make their first read. Inspecting, saving and loading
+ * require recording threads to be quiet.
+ */
+class clock_recording {
+public:
+	static constexpr std::size_t default_stream_capacity{ 1 << 20 }; ///< Bytes preallocated per thread
+
+	/**
+	 * @brief Constructs empty recording.
+	 * @param stream_capacity Bytes preallocated for every recording thread.
+	 */
+	explicit clock_recording(const std::size_t stream_capacity = default_stream_capacity);
+
+	clock_recording(const clock_recording &) = delete;
+	clock_recording &operator=(const clock_recording &) = delete;
+	~clock_recording();
+
+	/**
+	 * @brief Appends the value to the stream of the calling thread.
+	 * @param nanoseconds Clock read in nanoseconds since the clock epoch.
+	 */
+	void append(const i64 nanoseconds) noexcept;
+
+	/**
+	 * @brief Returns number of streams.
+	 */
+	[[nodiscard]] std::size_t streams() const;
+
+	/**
+	 * @brief Decodes recorded values of the stream. Empty if there's no such stream.
+	 */
+	[[nodiscard]] std::vector<i64> values(const std::size_t stream) const;
+
+	/**
+	 * @brief Returns true if the stream ran out of its capacity.
+	 */
+	[[nodiscard]] bool truncated(const std::size_t stream) const;
+
+	/**
+	 * @brief Returns total size of encoded streams in bytes.
+	 */
+	[[nodiscard]] std::size_t bytes() const;
+
+	/**
+	 * @brief Writes all streams to the binary file.
+	 * @return false if the file couldn't be written.
+	 */
+	bool save(const std::string &path) const;
+
+	/**
+	 * @brief Replaces streams with ones read from the file written by `save()`.
+	 * @details Replay clocks have to be created after loading.
+	 * @return false if the file couldn't be read or it's malformed. The recording stays empty then.
+	 */
+	bool load(const std::string &path);
+
+private:
+	struct stream;
+	friend class replay_clock;
+
+	u64 m_id;
+	const std::size_t m_capacity;
+	mutable std::mutex m_mutex;
+	std::vector<std::unique_ptr<stream>> m_streams;
+	std::unordered_map<std::thread::id, stream *> m_owners;
+
+	stream &thread_stream();
+	const stream *find(const std::size_t index) const;
+};
+
+/**
+ * @brief Stateful base clock which passes reads of BaseClock through and logs them.
+ * @ingroup Chrono clocks
+ * @details Clocks and timers take its instance in the constructor, so the whole timing behaviour
+ * could be captured and then replayed with golxzn::os::chrono::replay_clock.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::clock_recording recording;
+ * golxzn::os::chrono::recording_clock<> source{ recording };
+ * golxzn::os::chrono::fast_clock<golxzn::os::chrono::recording_clock<>> clock{ source };
+ * ... // run the workload
+ * recording.save("capture.gxclk");
+ * @endcode
+ * @tparam BaseClock Clock which is recorded.
+ */
+template<class BaseClock = utils::default_base_clock>
+class recording_clock : private utils::base_clock_ref<BaseClock> {
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	static_assert(BaseClock::is_steady, "[golxzn::os::chrono::recording_clock] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::recording_clock] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                                 ///< Recorded clock type
+	using rep = i64;                                              ///< Representation type
+	using period = std::nano;                                     ///< Tick period
+	using duration = std::chrono::duration<rep, period>;          ///< Duration type
+	using time_point = std::chrono::time_point<recording_clock>;  ///< Time point type
+
+	static constexpr bool is_steady{ true };
+
+	/**
+	 * @brief Constructs clock recording BaseClock with static `now()`.
+	 */
+	explicit recording_clock(clock_recording &recording) noexcept;
+
+	/**
+	 * @brief Constructs clock recording the base clock instance.
+	 */
+	recording_clock(base_clock &base, clock_recording &recording) noexcept;
+
+	recording_clock(const recording_clock &) = delete;
+	recording_clock &operator=(const recording_clock &) = delete;
+
+	/**
+	 * @brief Reads BaseClock and appends the result to the stream of the calling thread.
+	 */
+	[[nodiscard]] time_point now() const noexcept;
+
+private:
+	clock_recording &m_recording;
+};
+
+/**
+ * @brief Stateful base clock which returns values of golxzn::os::chrono::clock_recording one by one.
+ * @ingroup Chrono clocks
+ * @details Every thread reads its own stream. By default threads take streams in the order of their
+ * first `now()`, which matches the recording order for the same program; `bind()` maps a thread explicitly.
+ * When the stream is over, the last value is repeated. Threads without a stream observe the epoch.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::clock_recording recording;
+ * recording.load("capture.gxclk");
+ * golxzn::os::chrono::replay_clock source{ recording };
+ * golxzn::os::chrono::fast_clock<golxzn::os::chrono::replay_clock> clock{ source };
+ * ... // run the same workload, it observes exactly the same time
+ * @endcode
+ */
+class replay_clock {
+public:
+	using rep = i64;                                          ///< Representation type
+	using period = std::nano;                                 ///< Tick period
+	using duration = std::chrono::duration<rep, period>;      ///< Duration type
+	using time_point = std::chrono::time_point<replay_clock>; ///< Time point type
+
+	static constexpr bool is_steady{ true };
+
+	/**
+	 * @brief Constructs clock replaying the recording. It has to outlive the clock.
+	 */
+	explicit replay_clock(const clock_recording &recording);
+
+	replay_clock(const replay_clock &) = delete;
+	replay_clock &operator=(const replay_clock &) = delete;
+	~replay_clock();
+
+	/**
+	 * @brief Returns the next recorded value of the calling thread's stream.
+	 */
+	[[nodiscard]] time_point now() const noexcept;
+
+	/**
+	 * @brief Binds the calling thread to the stream and rewinds it.
+	 * @return false if there's no such stream.
+	 */
+	bool bind(const std::size_t stream);
+
+	/**
+	 * @brief Returns number of values left in the calling thread's stream.
+	 */
+	[[nodiscard]] std::size_t remaining() const;
+
+private:
+	struct cursor;
+
+	const u64 m_id;
+	const clock_recording &m_recording;
+	mutable std::mutex m_mutex;
+	mutable std::size_t m_next_stream{};
+	mutable std::unordered_map<std::thread::id, std::unique_ptr<cursor>> m_cursors;
+
+	cursor &thread_cursor() const;
+};
+
+#include "golxzn/os/chrono/impl/replay_clock.inl"
+
+} // namespace golxzn::os::chrono
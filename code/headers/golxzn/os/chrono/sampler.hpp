@@ -0,0 +1,147 @@
+/**
+ * @file golxzn/os/chrono/sampler.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Sampling profiler driven by per-thread CPU time timers
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono::profiler {
+
+/**
+ * @brief Sampled call stack.
+ * @ingroup Chrono profiler
+ */
+struct sampled_stack {
+	std::vector<std::uintptr_t> frames; ///< Code addresses from the outermost to the innermost
+	u64 samples{};                      ///< Number of samples with this stack
+};
+
+/**
+ * @brief Aggregated samples of all attached threads.
+ * @ingroup Chrono profiler
+ */
+struct sample_profile {
+	std::vector<sampled_stack> stacks; ///< Unique stacks
+	u64 dropped{};                     ///< Samples lost because thread buffers were full
+
+	/**
+	 * @brief Returns folded stacks (`outer;inner <samples>` per line) for flamegraph tools.
+	 * @details Addresses are symbolized with `dladdr`, so only exported symbols get names (link with `-rdynamic`
+	 * to export executable's ones). Unknown addresses are printed as `module+0xoffset`.
+	 */
+	[[nodiscard]] std::string folded() const;
+
+	/**
+	 * @brief Writes folded stacks to the file.
+	 * @return false if the file couldn't be written.
+	 */
+	bool write_folded(const std::string &path) const;
+};
+
+/**
+ * @brief Sampling profiler which finds hot paths without marking them. (Linux only)
+ * @ingroup Chrono profiler
+ * @details Each attached thread arms its own `CLOCK_THREAD_CPUTIME_ID` timer, so samples are taken
+ * in proportion to the CPU time the thread burns and idle threads cost nothing. The timer sends `SIGPROF`
+ * to the thread, and the handler walks frame pointers from the interrupted context into the thread's
+ * preallocated ring buffer without locks or allocations. `collect()` drains the rings and aggregates
+ * stacks outside of the signal handler.
+ *
+ * Stacks are as deep as frame pointers allow: build with `-fno-omit-frame-pointer` for full stacks,
+ * otherwise only the interrupted function and a few callers are captured. Frame pointers are walked
+ * on x86_64 and AArch64; other architectures record only the interrupted address.
+ *
+ * Only one sampler could be active at a time. After it's destroyed, `SIGPROF` stays ignored
+ * (or handled by the previous handler), because signals of deleted timers could still be pending.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::profiler::sampler sampler{ golxzn::os::chrono::milliseconds(10) };
+ *
+ * // in each profiled thread
+ * sampler.attach();
+ *
+ * // periodically
+ * sampler.collect().write_folded("cpu.folded");
+ * @endcode
+ */
+class sampler {
+public:
+	static constexpr std::size_t max_depth{ 64 };         ///< Maximum number of frames in a sample
+	static constexpr std::size_t default_capacity{ 1024 }; ///< Samples buffered per thread between collects
+
+	/**
+	 * @brief Returns true if sampling is supported by the platform.
+	 */
+	[[nodiscard]] static bool available() noexcept;
+
+	/**
+	 * @brief Installs the signal handler.
+	 * @param interval CPU time of a thread between its samples.
+	 * @param capacity Samples buffered per thread. Samples which don't fit until `collect()` are dropped.
+	 */
+	explicit sampler(const time interval, const std::size_t capacity = default_capacity);
+
+	sampler(const sampler &) = delete;
+	sampler &operator=(const sampler &) = delete;
+
+	/**
+	 * @brief Disarms timers of all threads.
+	 */
+	~sampler();
+
+	/**
+	 * @brief Returns true if the sampler is active: the platform is supported and no other sampler exists.
+	 */
+	[[nodiscard]] bool valid() const noexcept;
+
+	/**
+	 * @brief Starts sampling of the calling thread. The thread is detached automatically when it exits.
+	 * @return false if the sampler isn't valid or the timer couldn't be created.
+	 */
+	bool attach();
+
+	/**
+	 * @brief Stops sampling of the calling thread. Its collected samples are kept.
+	 */
+	void detach();
+
+	/**
+	 * @brief Drains thread buffers and returns all samples since construction.
+	 */
+	[[nodiscard]] sample_profile collect();
+
+	/**
+	 * @brief Returns sampling interval.
+	 */
+	[[nodiscard]] time interval() const noexcept;
+
+private:
+	struct thread_state;
+
+	const time m_interval;
+	const std::size_t m_capacity;
+	u64 m_generation{};
+	std::mutex m_mutex;
+	std::vector<std::shared_ptr<thread_state>> m_threads;
+	std::map<std::vector<std::uintptr_t>, u64> m_stacks;
+	u64 m_dropped{};
+
+	void drain(thread_state &state);
+	void disarm(thread_state &state) noexcept;
+};
+
+} // namespace golxzn::os::chrono::profiler
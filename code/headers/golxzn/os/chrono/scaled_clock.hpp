@@ -0,0 +1,156 @@
+/**
+ * @file golxzn/os/chrono/scaled_clock.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Tree of pausable and time-dilated clocks evaluated from one base clock read per frame
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Node of the clock tree which runs with its own rate and could be paused relative to its parent.
+ * @ingroup Chrono clocks
+ * @details The root node reads the base clock only in `update()`, once per frame. Every other node
+ * derives its time from the parent: `anchor + (parent - parent_anchor) * rate`, or just `anchor` while
+ * it's paused. Anchors are rebased on every rate or pause change, so changes affect only the future.
+ * Values are computed lazily and cached per frame, so evaluating thousands of nested clocks costs one
+ * base clock read plus a multiplication per node.
+ *
+ * Between updates all nodes return the time of the last frame.
+ * Nodes aren't thread-safe and parents have to outlive their children.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::scaled_clock<> world;
+ * golxzn::os::chrono::scaled_clock<> zone{ world, 0.5 }; // slow motion
+ * golxzn::os::chrono::scaled_clock<> entity{ zone, 1.0 };
+ *
+ * while (running) {
+ * 	world.update();
+ * 	entity.elapsed(); // no base clock read here
+ * 	if (menu_opened) zone.pause();
+ * }
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ * If it doesn't have static `now()`, the clock instance has to be passed to the root constructor.
+ */
+template<class BaseClock = utils::default_base_clock>
+class scaled_clock : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::scaled_clock] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::scaled_clock] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+
+	/**
+	 * @brief Constructs root clock starting at the current base clock time.
+	 */
+	scaled_clock() noexcept;
+
+	/**
+	 * @brief Constructs root clock which reads the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this clock.
+	 * @param base base clock instance
+	 */
+	explicit scaled_clock(base_clock &base) noexcept;
+
+	/**
+	 * @brief Constructs child clock starting at zero at the current frame of the tree.
+	 * @warning The parent has to outlive this clock.
+	 * @param parent Parent clock.
+	 * @param rate How fast this clock runs relative to the parent.
+	 */
+	scaled_clock(const scaled_clock &parent, const f64 rate) noexcept;
+
+	scaled_clock(const scaled_clock &) = delete;
+	scaled_clock(scaled_clock &&) = delete;
+	scaled_clock &operator=(const scaled_clock &) = delete;
+	scaled_clock &operator=(scaled_clock &&) = delete;
+
+	/**
+	 * @brief Reads the base clock and starts a new frame of the whole tree.
+	 * @details Could be called on any node, it always updates the root.
+	 * @return Elapsed time of this clock in the new frame.
+	 */
+	time update() noexcept;
+
+	/**
+	 * @brief Returns time of this clock in the current frame.
+	 */
+	[[nodiscard]] time elapsed() const noexcept;
+
+	/**
+	 * @brief Returns number of `update()` calls of the tree.
+	 */
+	[[nodiscard]] u64 frame() const noexcept;
+
+	/**
+	 * @brief Returns rate relative to the parent (or to the base clock for the root).
+	 */
+	[[nodiscard]] f64 rate() const noexcept;
+
+	/**
+	 * @brief Changes rate since the current frame. Negative rates run time backward.
+	 */
+	void set_rate(const f64 rate) noexcept;
+
+	/**
+	 * @brief Returns true if clock is paused.
+	 * @details Children of the paused clock are frozen as well, but stay unpaused themselves.
+	 */
+	[[nodiscard]] bool paused() const noexcept;
+
+	/**
+	 * @brief Freezes the clock at the current frame time.
+	 */
+	void pause() noexcept;
+
+	/**
+	 * @brief Continues the clock from the current frame time.
+	 */
+	void resume() noexcept;
+
+	/**
+	 * @brief Returns true if this clock is the root of the tree.
+	 */
+	[[nodiscard]] bool is_root() const noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+	using rep = i64; ///< Nanoseconds
+
+	const scaled_clock *const m_parent{};
+	scaled_clock *const m_root{ this };
+
+	/// Used only by the root
+	time_point m_start{};
+	rep m_base_elapsed{};
+	u64 m_frame{ 1 };
+
+	rep m_parent_anchor{};
+	rep m_anchor{};
+	f64 m_rate{ 1.0 };
+	bool m_paused{};
+
+	mutable rep m_cached{};
+	mutable u64 m_cached_frame{};
+
+	[[nodiscard]] rep value() const noexcept;
+	[[nodiscard]] rep source() const noexcept;
+	void rebase() noexcept;
+};
+
+#include "golxzn/os/chrono/impl/scaled_clock.inl"
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,194 @@
+/**
+ * @file golxzn/os/chrono/shm_clock.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Clock published through a shared memory page for multi-process readers
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Layout of the published page.
+ * @ingroup Chrono shm_clock
+ * @details The page is protected by a sequence lock: the writer makes `sequence` odd while it updates
+ * the values, so readers retry if they see an odd or changed sequence.
+ */
+struct alignas(64) shm_clock_page {
+	static constexpr u32 expected_magic{ 0x67786374 }; ///< Marks initialized page
+	static constexpr u32 expected_version{ 1 };        ///< Page layout version
+
+	std::atomic<u32> magic{};          ///< expected_magic when the page is initialized
+	std::atomic<u32> version{};        ///< Page layout version
+	std::atomic<u64> sequence{};       ///< Sequence lock counter
+	std::atomic<i64> steady{};         ///< Monotonic time since steady clock epoch in nanoseconds
+	std::atomic<i64> wall_offset{};    ///< Difference between system clock and steady clock in nanoseconds
+
+	static_assert(std::atomic<u64>::is_always_lock_free && std::atomic<i64>::is_always_lock_free,
+		"[golxzn::os::chrono::shm_clock_page] 64-bit atomics have to be lock free to be shared between processes");
+};
+
+/**
+ * @brief Writes current time to the shared memory page at a fixed rate.
+ * @ingroup Chrono shm_clock
+ * @details Creates the shared memory object with the given name and owns it: the object is removed when the
+ * publisher is destroyed. The time is taken from `std::chrono::steady_clock` which is system-wide,
+ * so readers' timestamps are comparable with their own steady clock.
+ *
+ * If `GOLXZN_MULTITHREADING` is defined, `start()` runs the thread which publishes time every interval.
+ * Otherwise `publish()` has to be called manually.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::shm_clock_publisher publisher{ "/service_clock", golxzn::os::chrono::microseconds(100) };
+ * publisher.start();
+ * @endcode
+ */
+class shm_clock_publisher {
+public:
+	/**
+	 * @brief Creates and maps shared memory object and publishes current time.
+	 * @details The object must not exist: if another publisher owns the name (or a crashed one left it,
+	 * see remove()), the publisher isn't valid.
+	 * @param name Shared memory object name. It's prefixed with '/' if it isn't.
+	 * @param interval Publishing interval.
+	 */
+	shm_clock_publisher(std::string_view name, const time interval);
+
+	shm_clock_publisher(const shm_clock_publisher &) = delete;
+	shm_clock_publisher &operator=(const shm_clock_publisher &) = delete;
+	~shm_clock_publisher();
+
+	/**
+	 * @brief Removes shared memory object left by a crashed publisher.
+	 * @warning Readers and the publisher which still map it keep the old page.
+	 * @return false if there's no such object.
+	 */
+	static bool remove(std::string_view name) noexcept;
+
+	/**
+	 * @brief Returns true if shared memory page was created and mapped.
+	 * @details false if another publisher with the same name exists.
+	 */
+	[[nodiscard]] bool valid() const noexcept;
+
+	/**
+	 * @brief Writes current time to the page.
+	 */
+	void publish() noexcept;
+
+	/**
+	 * @brief Returns publishing interval.
+	 */
+	[[nodiscard]] time interval() const noexcept;
+
+#if defined(GOLXZN_MULTITHREADING)
+	/**
+	 * @brief Starts the thread which publishes time every interval. (only when GOLXZN_MULTITHREADING is defined)
+	 */
+	void start();
+
+	/**
+	 * @brief Stops publishing thread. (only when GOLXZN_MULTITHREADING is defined)
+	 */
+	void stop();
+#endif // defined(GOLXZN_MULTITHREADING)
+
+private:
+	const std::string m_name;
+	const time m_interval;
+	void *m_handle{};
+	shm_clock_page *m_page{};
+
+#if defined(GOLXZN_MULTITHREADING)
+	std::mutex m_mutex;
+	std::condition_variable m_wakeup;
+	bool m_running{};
+	std::thread m_thread;
+#endif // defined(GOLXZN_MULTITHREADING)
+};
+
+/**
+ * @brief Stateful base clock which reads time published by golxzn::os::chrono::shm_clock_publisher.
+ * @ingroup Chrono clocks
+ * @details Reading is a few loads from the mapped page without any syscall. The resolution is the
+ * publishing interval, and time stays the same if publisher is stopped. If the publisher dies in the
+ * middle of writing, reads fall back to `std::chrono::steady_clock` (see stale()) without waiting again
+ * until the sequence changes. Returned time never goes back, even when reads switch between the page
+ * and the fallback. Clocks and timers
+ * take its instance in the constructor.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::shm_clock service_time{ "/service_clock" };
+ * golxzn::os::chrono::fast_timer<golxzn::os::chrono::shm_clock> timer{ service_time, 10ms };
+ * while (!timer.is_done()) {
+ * 	process();
+ * }
+ * @endcode
+ */
+class shm_clock {
+public:
+	using rep = i64;                                       ///< Representation type
+	using period = std::nano;                              ///< Tick period
+	using duration = std::chrono::duration<rep, period>;   ///< Duration type
+	using time_point = std::chrono::time_point<shm_clock>; ///< Time point type
+
+	static constexpr bool is_steady{ true };
+
+	/**
+	 * @brief Maps the page published with the given name for reading.
+	 * @param name Shared memory object name. It's prefixed with '/' if it isn't.
+	 */
+	explicit shm_clock(std::string_view name);
+
+	shm_clock(const shm_clock &) = delete;
+	shm_clock &operator=(const shm_clock &) = delete;
+	~shm_clock();
+
+	/**
+	 * @brief Returns true if the page was mapped and initialized by the publisher.
+	 */
+	[[nodiscard]] bool valid() const noexcept;
+
+	/**
+	 * @brief Returns last published monotonic time. It's the epoch if the page isn't mapped.
+	 */
+	[[nodiscard]] time_point now() const noexcept;
+
+	/**
+	 * @brief Returns last published time converted to system clock.
+	 */
+	[[nodiscard]] std::chrono::system_clock::time_point wall_now() const noexcept;
+
+	/**
+	 * @brief Returns true if the last read found the page locked for too long and took the time
+	 * from `std::chrono::steady_clock` instead, e.g. because the publisher died while writing.
+	 */
+	[[nodiscard]] bool stale() const noexcept;
+
+private:
+	void *m_handle{};
+	const shm_clock_page *m_page{};
+	mutable std::atomic<u64> m_stale_sequence{}; ///< Odd sequence the writer has died with, 0 if it's alive
+	mutable std::atomic<i64> m_last{};           ///< The latest returned monotonic time in nanoseconds
+
+	void read(i64 &steady, i64 &wall_offset) const noexcept;
+};
+
+} // namespace golxzn::os::chrono
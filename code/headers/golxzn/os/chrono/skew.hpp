@@ -0,0 +1,138 @@
+/**
+ * @file golxzn/os/chrono/skew.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Cross-core consistency checker of base clocks
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <atomic>
+#include <thread>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/utils.hpp"
+
+namespace golxzn::os::chrono {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+/**
+ * @brief Settings of golxzn::os::chrono::check_skew. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono skew
+ */
+struct skew_options {
+	u32 rounds{ 1000 };     ///< Ping-pong exchanges per core pair
+	u32 reads{ 100'000 };   ///< Back-to-back reads per core to measure the read cost
+	std::vector<u32> cores; ///< Checked cores. All available cores if empty
+};
+
+/**
+ * @brief Clock behaviour on one core.
+ * @ingroup Chrono skew
+ */
+struct core_skew {
+	u32 core{};                      ///< Core index
+	bool pinned{};                   ///< false if the thread couldn't be pinned to the core
+	std::chrono::nanoseconds cost{}; ///< Average cost of one read
+	u64 violations{};                ///< Reads which went backwards on the same core
+};
+
+/**
+ * @brief Clock consistency between two cores.
+ * @ingroup Chrono skew
+ */
+struct pair_skew {
+	u32 first{};                           ///< Core which initiates exchanges
+	u32 second{};                          ///< Core which answers
+	std::chrono::nanoseconds offset{};     ///< Estimated clock of the second core minus the first one
+	std::chrono::nanoseconds round_trip{}; ///< The shortest exchange. Offset is known within its half
+	u64 violations{};                      ///< Answers timestamped before the request or after the reply
+};
+
+/**
+ * @brief Result of golxzn::os::chrono::check_skew.
+ * @ingroup Chrono skew
+ */
+struct skew_report {
+	std::vector<core_skew> cores;
+	std::vector<pair_skew> pairs;
+
+	/**
+	 * @brief Returns total number of monotonicity violations of all cores and pairs.
+	 */
+	[[nodiscard]] u64 violations() const noexcept;
+
+	/**
+	 * @brief Returns the largest absolute offset between cores.
+	 */
+	[[nodiscard]] std::chrono::nanoseconds max_offset() const noexcept;
+
+	/**
+	 * @brief Returns true if there are no violations and every offset is within the measurement
+	 * uncertainty (half of the round trip) plus tolerance.
+	 */
+	[[nodiscard]] bool consistent(const std::chrono::nanoseconds tolerance = std::chrono::nanoseconds::zero()) const noexcept;
+};
+
+/**
+ * @brief Checks if timestamps of BaseClock taken on different cores are ordered.
+ * @ingroup Chrono skew
+ * @details For each core a pinned thread reads the clock back to back, measuring the read cost and
+ * counting reads which went backwards. For each pair of cores two pinned threads exchange timestamps
+ * through a shared cache line: the first core reads `t0` and sends a request, the second one answers
+ * with its `t1`, and the first reads `t2` after the answer. Causality requires `t0 <= t1 <= t2`,
+ * otherwise it's a violation. The offset is `t1 - (t0 + t2) / 2` of the exchange with the shortest
+ * round trip.
+ *
+ * It takes about `rounds * cores^2 / 2` exchanges, so it's fast enough to be run at startup to validate
+ * clock choice for golxzn::os::chrono::fast_clock or golxzn::os::chrono::timer.
+ * Threads aren't pinned on platforms without thread affinity (e.g. macOS), see core_skew::pinned.
+ *
+ * Usage:
+ * @code{.cpp}
+ * const auto report{ golxzn::os::chrono::check_skew<std::chrono::steady_clock>() };
+ * if (!report.consistent(100ns)) {
+ * 	// fall back to another clock
+ * }
+ * @endcode
+ * @tparam BaseClock Checked clock.
+ */
+template<class BaseClock = utils::default_base_clock>
+[[nodiscard]] skew_report check_skew(const skew_options &options = {});
+
+/**
+ * @brief Checks if timestamps of the stateful base clock taken on different cores are ordered.
+ * @ingroup Chrono skew
+ * @see check_skew(const skew_options &options)
+ */
+template<class BaseClock>
+[[nodiscard]] skew_report check_skew(BaseClock &base, const skew_options &options = {});
+
+namespace details {
+
+/**
+ * @brief Returns logical cores the process is allowed to run on.
+ */
+[[nodiscard]] std::vector<u32> available_cores();
+
+/**
+ * @brief Pins the calling thread to the core.
+ * @return false if the platform doesn't support affinity or the core isn't available.
+ */
+bool pin_current_thread(const u32 core) noexcept;
+
+} // namespace details
+
+#include "golxzn/os/chrono/impl/skew.inl"
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono
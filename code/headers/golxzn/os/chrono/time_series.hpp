@@ -0,0 +1,151 @@
+/**
+ * @file golxzn/os/chrono/time_series.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Ring of per-interval counters for throughput over time
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+
+namespace golxzn::os::chrono {
+
+namespace details {
+
+/**
+ * @brief Returns small number unique for the calling thread. Numbers are assigned in order of first call.
+ */
+[[nodiscard]] std::size_t thread_index() noexcept;
+
+} // namespace details
+
+/**
+ * @brief Counters of consecutive intervals returned by golxzn::os::chrono::time_series_ring.
+ * @ingroup Chrono time_series
+ * @details `values[i]` is the sum over `[start + i * granularity, start + (i + 1) * granularity)`,
+ * the last value is the current (incomplete) interval.
+ */
+struct time_series {
+	time start{};            ///< Start of the first interval since the base clock epoch
+	time granularity{};      ///< Interval duration
+	std::vector<u64> values; ///< Values from the oldest to the newest interval
+};
+
+/**
+ * @brief Ring of counters keyed by coarse time intervals.
+ * @ingroup Chrono time_series
+ * @details The ring keeps the last `intervals` intervals of `granularity` each for several series
+ * (e.g. requests, bytes and errors). Increments go to per-thread stripes of cache line sized slots,
+ * so threads don't contend on the same counters. There's no background thread: the first increment
+ * in a new interval zeroes the reused slots, and snapshots skip intervals nobody wrote to.
+ * Increments which race with zeroing could be lost.
+ *
+ * Usage:
+ * @code{.cpp}
+ * enum metric : std::size_t { requests, bytes, errors, count };
+ * golxzn::os::chrono::time_series_ring<> throughput{ golxzn::os::chrono::milliseconds(1000), 300, metric::count };
+ *
+ * throughput.add(1, metric::requests);
+ * throughput.add(response.size(), metric::bytes);
+ *
+ * const auto last_5_minutes{ throughput.snapshot(metric::requests) };
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class time_series_ring : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::time_series_ring] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::time_series_ring] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+
+	/**
+	 * @brief Constructs ring.
+	 * @param granularity Interval duration.
+	 * @param intervals Number of kept intervals including the current one.
+	 * @param series Number of counters per interval.
+	 * @param stripes Number of per-thread slots. Zero means the number of hardware threads.
+	 */
+	time_series_ring(const time granularity, const std::size_t intervals, const std::size_t series = 1,
+		const std::size_t stripes = 0);
+
+	/**
+	 * @brief Constructs ring which uses the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this ring.
+	 */
+	time_series_ring(base_clock &base, const time granularity, const std::size_t intervals,
+		const std::size_t series = 1, const std::size_t stripes = 0);
+
+	time_series_ring(const time_series_ring &) = delete;
+	time_series_ring &operator=(const time_series_ring &) = delete;
+
+	/**
+	 * @brief Adds value to the current interval of the series. Lock-free, could be called from any thread.
+	 * @param value Value to add.
+	 * @param series Series index. Out of range indices are ignored.
+	 */
+	void add(const u64 value = 1, const std::size_t series = 0) noexcept;
+
+	/**
+	 * @brief Returns values of the series over all kept intervals. O(intervals * stripes).
+	 */
+	[[nodiscard]] time_series snapshot(const std::size_t series = 0) const;
+
+	/**
+	 * @brief Returns interval duration.
+	 */
+	[[nodiscard]] time granularity() const noexcept;
+
+	/**
+	 * @brief Returns number of kept intervals.
+	 */
+	[[nodiscard]] std::size_t intervals() const noexcept;
+
+	/**
+	 * @brief Returns number of series.
+	 */
+	[[nodiscard]] std::size_t series() const noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+	static constexpr std::size_t counters_per_line{ 64 / sizeof(std::atomic<u64>) };
+
+	struct alignas(64) interval_epoch {
+		std::atomic<i64> value{ -1 };
+	};
+
+	struct alignas(64) line {
+		std::atomic<u64> values[counters_per_line]{};
+	};
+
+	const i64 m_granularity;
+	const std::size_t m_intervals;
+	const std::size_t m_series;
+	const std::size_t m_stripes;
+	const std::size_t m_lines_per_stripe;
+	std::unique_ptr<interval_epoch[]> m_epochs;
+	std::unique_ptr<line[]> m_lines;
+
+	[[nodiscard]] i64 current_epoch() const noexcept;
+	[[nodiscard]] std::atomic<u64> &counter(const std::size_t interval, const std::size_t stripe,
+		const std::size_t series) const noexcept;
+};
+
+#include "golxzn/os/chrono/impl/time_series.inl"
+
+} // namespace golxzn::os::chrono
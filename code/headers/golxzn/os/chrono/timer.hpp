@@ -11,7 +11,15 @@
 
 #include <thread>
 
+#if defined(GOLXZN_MULTITHREADING)
+#include <mutex>
+#include <condition_variable>
+#endif // defined(GOLXZN_MULTITHREADING)
+
 #include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/deadline.hpp"
+#include "golxzn/os/chrono/lateness.hpp"
+#include "golxzn/os/chrono/timer_service.hpp"
 
 namespace golxzn::os::chrono {
 
@@ -20,7 +28,8 @@ namespace constants {
 /**
  * @brief Default precision of timer.
  * > Only if `GOLXZN_MULTITHREADING` is defined.
- * This value is used as time to wait inside timer thread.
+ * This value is used as time to wait inside timer thread, which is used only for stateful base clocks
+ * that can't dispatch callbacks by themselves.
  * @code{.cpp}
  * while(is_running()) {
  * 	std::this_thread::sleep_for(default_precision);
@@ -31,6 +40,54 @@ static constexpr std::chrono::microseconds default_precision{ i64{ 1 } };
 
 } // namespace constants
 
+#if defined(GOLXZN_MULTITHREADING)
+
+namespace details {
+
+/**
+ * @brief One-shot event signalled when the callback of golxzn::os::chrono::timer has been called.
+ */
+class timer_completion {
+public:
+	/**
+	 * @brief Marks the callback as called and wakes the waiter.
+	 */
+	void notify() noexcept;
+
+	/**
+	 * @brief Blocks until notify() is called.
+	 */
+	void wait() noexcept;
+
+	/**
+	 * @brief Blocks until notify() is called or the time point is reached.
+	 * @return true if notify() has been called.
+	 */
+	template<class Clock, class Duration>
+	bool wait_until(const std::chrono::time_point<Clock, Duration> point) noexcept;
+
+	/**
+	 * @brief Returns true if notify() has been called.
+	 */
+	[[nodiscard]] bool done() noexcept;
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	bool m_done{};
+};
+
+/**
+ * @brief Returns the process-wide service which drives golxzn::os::chrono::timer.
+ * @details Constructed on the first use with one shard per core.
+ */
+template<class BaseClock>
+[[nodiscard]] sharded_timer_service<BaseClock> &shared_timer_service();
+
+} // namespace details
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
 /**
  * @brief Class that represents timer.
  * @ingroup Chrono timers
@@ -41,8 +98,17 @@ static constexpr std::chrono::microseconds default_precision{ i64{ 1 } };
  * This class is used to measure time. It calls callback when it's done.
  * If `GOLXZN_MULTITHREADING` __is not__ defined it doesn't use a thread.
  * So to call callback it has to be updated in main thread. It storing callback.
- * If `GOLXZN_MULTITHREADING` __is__ defined it uses a thread.
- * So to call callback it doesn't have to be updated. It doesn't storing callback, but std::thread
+ * If `GOLXZN_MULTITHREADING` __is__ defined it doesn't have to be updated. Base clocks with static `now()`
+ * arm the timer on the process-wide golxzn::os::chrono::sharded_timer_service, so the callback is called
+ * by the driver of the current core's shard and thousands of timers cost no threads. The callback has to
+ * be short, because it delays other timers of the shard. Destructor waits until the callback is called;
+ * a timer destroyed inside a timer callback doesn't wait: it's taken back from the service, and its callback
+ * is called right away if it's overdue, or by a detached thread at the deadline otherwise. If the service
+ * has no free slot (it's not freed while a timer callback of the shard runs), the timer gets its own thread.
+ * If the base clock is able to dispatch callbacks by itself (see golxzn::os::chrono::utils::has_scheduler),
+ * the callback is handed to the clock instead, and it's cancelled on timer destruction, or waited for if
+ * the clock is calling it right now.
+ * Other stateful base clocks are polled by a thread of the timer.
  *
  * Example of using:
  * @code{.cpp}
@@ -57,7 +123,7 @@ static constexpr std::chrono::microseconds default_precision{ i64{ 1 } };
  * @endcode
  */
 template<class OnTimerDone, class BaseClock = utils::default_base_clock>
-class timer {
+class timer : private utils::base_clock_ref<BaseClock> {
 	static_assert(BaseClock::is_steady,
 		"[golxzn::os::chrono::timer] BaseClock is not a monotonic clock");
 	static_assert(utils::enough_resolution_v<BaseClock>,
@@ -77,7 +143,8 @@ public:
 	 * @warning There's no invalid function checking! It'll terminate if callback is invalid.
 	 * @param timer_interval Timer interval.
 	 * @param callback Function that will be called after timer_interval.
-	 * @param precision Precision of timer. By default it's 1 microsecond (1us). Only if `GOLXZN_MULTITHREADING` is defined.
+	 * @param precision Precision of timer. By default it's 1 microsecond (1us). Only if `GOLXZN_MULTITHREADING` is defined
+	 * and only for the timer thread (see constants::default_precision).
 	 */
 	template<class Rep, class Period>
 	timer(const std::chrono::duration<Rep, Period> timer_interval, timer_end_callback &&callback
@@ -93,7 +160,8 @@ public:
 	 * @warning There's no invalid function checking! It'll terminate if callback is invalid.
 	 * @param timer_interval Timer interval.
 	 * @param callback Function that will be called after timer_interval.
-	 * @param precision Precision of timer. By default it's 1 microsecond (1us). Only if `GOLXZN_MULTITHREADING` is defined.
+	 * @param precision Precision of timer. By default it's 1 microsecond (1us). Only if `GOLXZN_MULTITHREADING` is defined
+	 * and only for the timer thread (see constants::default_precision).
 	 */
 	timer(const time timer_interval, timer_end_callback &&callback
 #if defined(GOLXZN_MULTITHREADING)
@@ -101,7 +169,49 @@ public:
 #endif // defined(GOLXZN_MULTITHREADING)
 	);
 
+	/**
+	 * @brief Timer constructor from base clock instance, timer interval and callback.
+	 * @ingroup Chrono timers construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this timer.
+	 * @param base Base clock instance.
+	 * @param timer_interval Timer interval.
+	 * @param callback Function that will be called after timer_interval.
+	 * @param precision Precision of timer. By default it's 1 microsecond (1us). Only if `GOLXZN_MULTITHREADING` is defined
+	 * and only for the timer thread (see constants::default_precision).
+	 */
+	template<class Rep, class Period>
+	timer(base_clock &base, const std::chrono::duration<Rep, Period> timer_interval, timer_end_callback &&callback
 #if defined(GOLXZN_MULTITHREADING)
+		, const std::chrono::microseconds precision = constants::default_precision
+#endif // defined(GOLXZN_MULTITHREADING)
+	);
+
+	/**
+	 * @brief Timer constructor from base clock instance, timer interval and callback.
+	 * @ingroup Chrono timers construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this timer.
+	 * @param base Base clock instance.
+	 * @param timer_interval Timer interval.
+	 * @param callback Function that will be called after timer_interval.
+	 * @param precision Precision of timer. By default it's 1 microsecond (1us). Only if `GOLXZN_MULTITHREADING` is defined
+	 * and only for the timer thread (see constants::default_precision).
+	 */
+	timer(base_clock &base, const time timer_interval, timer_end_callback &&callback
+#if defined(GOLXZN_MULTITHREADING)
+		, const std::chrono::microseconds precision = constants::default_precision
+#endif // defined(GOLXZN_MULTITHREADING)
+	);
+
+#if defined(GOLXZN_MULTITHREADING)
+	timer(const timer &) = delete;
+	timer &operator=(const timer &) = delete;
+
+	/**
+	 * @brief Waits until the callback is called, or cancels it if the base clock dispatches it and
+	 * hasn't started calling it yet.
+	 */
 	~timer() noexcept;
 #endif // defined(GOLXZN_MULTITHREADING)
 
@@ -136,14 +246,26 @@ public:
 	[[nodiscard]] time time_left() const noexcept;
 
 private:
-	const time_point m_start_time{ base_clock::now() };
-	const time_point m_timer_interval;
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+	static constexpr bool clock_dispatch{ utils::has_scheduler_v<BaseClock> && !utils::has_static_now_v<BaseClock> };
+	static constexpr bool service_dispatch{ utils::has_static_now_v<BaseClock> };
+	static constexpr u32 arm_attempts{ 64 }; ///< Attempts to arm on a full service before taking a thread
 
-#if defined(GOLXZN_MULTITHREADING)
-	std::thread m_timer_thread;
-#else // ^^^ defined(GOLXZN_MULTITHREADING) ^^^ / vvv !defined(GOLXZN_MULTITHREADING) vvv
+	const basic_deadline<BaseClock> m_deadline;
 	timer_end_callback m_callback;
-#endif // !defined(GOLXZN_MULTITHREADING)
+
+#if defined(GOLXZN_MULTITHREADING)
+	/// Timer armed on the shared service, task scheduled in the base clock or the timer thread.
+	std::conditional_t<service_dispatch, timer_handle,
+		std::conditional_t<clock_dispatch, typename utils::scheduler_task<BaseClock>::type, std::thread>> m_dispatcher;
+	details::timer_completion m_completion;
+	std::thread m_helper;                  ///< Calls the callback if the service had no free slot
+	details::timer_completion m_released;  ///< Stops the helper when the timer is destroyed on a driver
+
+	void start(const std::chrono::microseconds precision);
+	void fire();
+	void release();
+#endif // defined(GOLXZN_MULTITHREADING)
 };
 
 /**
@@ -153,8 +275,8 @@ private:
  * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
  *
  * This class is used to measure time. It doesn't use a thread and callback.
- * It stores only start time and timer interval, which is passing in constructor.
- * So it's very lightweight. It's just check if the creating time + interval is less than current time.
+ * It stores only the deadline (creating time + interval), so it's very lightweight:
+ * it's just check if the deadline is less than current time.
  *
  * Example of using:
  * @code{.cpp}
@@ -166,7 +288,7 @@ private:
  * @endcode
  */
 template<class BaseClock = utils::default_base_clock>
-class fast_timer {
+class fast_timer : private utils::base_clock_ref<BaseClock> {
 	static_assert(BaseClock::is_steady,
 		"[golxzn::os::chrono::fast_timer] BaseClock is not a monotonic clock");
 	static_assert(utils::enough_resolution_v<BaseClock>,
@@ -204,6 +326,44 @@ public:
 	template<class Rep, class Period>
 	explicit constexpr fast_timer(const std::chrono::duration<Rep, Period> timer_interval) noexcept;
 
+	/**
+	 * @brief fast_timer constructor from base clock instance and timer interval.
+	 * @ingroup Chrono timers construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this timer.
+	 * @param base Base clock instance.
+	 * @param timer_interval Timer interval.
+	 */
+	constexpr fast_timer(base_clock &base, const time timer_interval) noexcept;
+
+	/**
+	 * @brief fast_timer constructor from base clock instance and timer interval.
+	 * @ingroup Chrono timers construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this timer.
+	 * @param base Base clock instance.
+	 * @param timer_interval Timer interval.
+	 */
+	template<class Rep, class Period>
+	constexpr fast_timer(base_clock &base, const std::chrono::duration<Rep, Period> timer_interval) noexcept;
+
+	/**
+	 * @brief fast_timer constructor from deadline.
+	 * @ingroup Chrono timers construction
+	 * @param until Deadline of the timer.
+	 */
+	explicit constexpr fast_timer(const basic_deadline<BaseClock> until) noexcept;
+
+	/**
+	 * @brief fast_timer constructor from base clock instance and deadline.
+	 * @ingroup Chrono timers construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this timer.
+	 * @param base Base clock instance.
+	 * @param until Deadline of the timer.
+	 */
+	constexpr fast_timer(base_clock &base, const basic_deadline<BaseClock> until) noexcept;
+
 	/**
 	 * @brief Returns true if timer is done.
 	 * @see constexpr bool is_running() const noexcept
@@ -225,9 +385,15 @@ public:
 	 */
 	[[nodiscard]] constexpr time time_left() const noexcept;
 
+	/**
+	 * @brief Returns the deadline of the timer.
+	 */
+	[[nodiscard]] constexpr basic_deadline<BaseClock> deadline() const noexcept;
+
 private:
-	const time_point m_start_time{ base_clock::now() };
-	const time_point m_timer_interval;
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	const basic_deadline<BaseClock> m_deadline;
 };
 
 #include "golxzn/os/chrono/impl/timer.inl"
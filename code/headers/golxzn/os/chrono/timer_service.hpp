@@ -0,0 +1,432 @@
+/**
+ * @file golxzn/os/chrono/timer_service.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Shared timer services with lock-free arming, O(1) cancellation and per-core sharding
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <functional>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/deadline.hpp"
+#include "golxzn/os/chrono/lateness.hpp"
+#include "golxzn/os/chrono/bounded_queue.hpp"
+#include "golxzn/os/chrono/skew.hpp"
+
+namespace golxzn::os::chrono {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+/**
+ * @brief Handle of the armed timer. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono timer_service
+ * @details Slot index and its generation, so handles of fired or cancelled timers never match reused slots.
+ */
+struct timer_handle {
+	static constexpr u32 invalid_index{ std::numeric_limits<u32>::max() };
+
+	u32 index{ invalid_index }; ///< Slot of the timer
+	u32 generation{};           ///< Generation of the slot when the timer was armed
+	u32 shard{};                ///< Shard of golxzn::os::chrono::sharded_timer_service, 0 for a single service
+
+	/**
+	 * @brief Returns false if arming has failed.
+	 */
+	[[nodiscard]] constexpr bool valid() const noexcept { return index != invalid_index; }
+};
+
+/**
+ * @brief Statistics of golxzn::os::chrono::timer_service. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono timer_service
+ */
+struct timer_service_stats {
+	u64 armed{};         ///< Armed timers
+	u64 fired{};         ///< Fired timers
+	u64 cancelled{};     ///< Successfully cancelled timers
+	u64 rejected{};      ///< Arms rejected because all slots were busy
+	u64 batches{};       ///< Non-empty batches of arm requests drained by the owner
+	u64 largest_batch{}; ///< The largest drained batch
+};
+
+/**
+ * @brief Timer structure shared by many threads with lock-free arm and cancel. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono timer_service
+ * @details Timers live in a fixed pool of slots. `arm()` takes a free slot from a lock-free stack, fills it
+ * and pushes it to the lock-free MPSC list of arm requests. The owner (the driver thread after `start()`,
+ * or any single thread calling `poll()`) swaps the whole list out in one exchange, moves the batch into
+ * its deadline heap and calls expired callbacks. No thread ever takes a lock on this path.
+ *
+ * `cancel()` is a single CAS on the slot state (`armed` to `cancelled`); firing does the opposite CAS
+ * (`armed` to `firing`), so exactly one of them wins and a cancelled timer never fires. Cancelled
+ * timers are removed from the heap lazily: when they reach the top, or by compaction once they make up
+ * half of the heap or a quarter of the slots. The owner frees slots and destroys callbacks, so it's the only
+ * producer of free slots.
+ *
+ * Callbacks are called by the owner, so they have to be short. They could arm and cancel timers.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::timer_service<> timers;
+ * timers.start();
+ *
+ * // any I/O thread
+ * const auto timeout{ timers.arm(golxzn::os::chrono::milliseconds(500), [&connection] { connection.abort(); }) };
+ * ...
+ * if (reply_received) timers.cancel(timeout);
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ * The driver thread requires BaseClock with static `now()`, stateful clocks are driven by `poll()`.
+ */
+template<class BaseClock = utils::default_base_clock>
+class timer_service : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::timer_service] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::timer_service] BaseClock's resolution is less than microseconds!");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+	using deadline_type = basic_deadline<BaseClock>;    ///< Deadline type
+	using callback = std::function<void()>;             ///< Timer callback type
+
+	static constexpr std::size_t default_capacity{ std::size_t{ 1 } << 14 }; ///< Default number of slots
+
+	/**
+	 * @brief Constructs service without the driver thread.
+	 * @param capacity Maximum number of timers armed at once.
+	 */
+	explicit timer_service(const std::size_t capacity = default_capacity);
+
+	/**
+	 * @brief Constructs service which uses the given base clock instance.
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this service.
+	 */
+	explicit timer_service(base_clock &base, const std::size_t capacity = default_capacity);
+
+	timer_service(const timer_service &) = delete;
+	timer_service &operator=(const timer_service &) = delete;
+
+	/**
+	 * @brief Stops the driver thread. Timers which haven't fired are dropped.
+	 */
+	~timer_service();
+
+	/**
+	 * @brief Arms timer which fires at the deadline. Could be called from any thread.
+	 * @return Invalid handle if all slots are busy.
+	 */
+	timer_handle arm(const deadline_type deadline, callback &&task);
+
+	/**
+	 * @brief Arms timer which fires after the interval.
+	 * @see arm(const deadline_type deadline, callback &&task)
+	 */
+	timer_handle arm(const time interval, callback &&task);
+
+	/**
+	 * @brief Arms timer which fires after the interval.
+	 * @see arm(const deadline_type deadline, callback &&task)
+	 */
+	template<class Rep, class Period>
+	timer_handle arm(const std::chrono::duration<Rep, Period> interval, callback &&task);
+
+	/**
+	 * @brief Cancels timer. Could be called from any thread.
+	 * @return true if the timer won't fire. false if it has fired, is firing right now or was cancelled.
+	 */
+	bool cancel(const timer_handle handle) noexcept;
+
+	/**
+	 * @brief Drains arm requests and calls callbacks of expired timers on the calling thread.
+	 * @warning Only one thread could poll at a time, and not while the driver thread is running.
+	 * @return Number of fired timers.
+	 */
+	std::size_t poll();
+
+	/**
+	 * @brief Starts the driver thread which polls whenever the earliest timer expires or a more urgent one is armed.
+	 */
+	void start();
+
+	/**
+	 * @brief Starts the driver thread pinned to the core.
+	 * @details Pinning is best effort, the driver runs unpinned where affinity isn't supported.
+	 * @see start()
+	 */
+	void start(const u32 core);
+
+	/**
+	 * @brief Stops the driver thread. Armed timers stay armed.
+	 */
+	void stop();
+
+	/**
+	 * @brief Returns true if the driver thread is running.
+	 */
+	[[nodiscard]] bool running() const noexcept;
+
+	/**
+	 * @brief Returns maximum number of timers armed at once.
+	 */
+	[[nodiscard]] std::size_t capacity() const noexcept;
+
+	/**
+	 * @brief Returns statistics since construction.
+	 */
+	[[nodiscard]] timer_service_stats stats() const noexcept;
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+	using rep = typename time_point::rep;
+
+	enum status : u64 { idle, armed, cancelled, firing };
+	static constexpr u64 status_bits{ 2 };
+	static constexpr u64 status_mask{ (u64{ 1 } << status_bits) - 1 };
+	static constexpr u32 no_slot{ timer_handle::invalid_index };
+	static constexpr u32 any_core{ std::numeric_limits<u32>::max() };
+
+	struct slot {
+		std::atomic<u64> state{};    ///< generation << status_bits | status
+		std::atomic<u32> free_next{ no_slot };
+		slot *arm_next{};
+		time_point deadline{};
+		callback task;
+	};
+
+	struct entry {
+		rep deadline;
+		u64 order;
+		u32 index;
+	};
+
+	struct alignas(64) counter {
+		std::atomic<u64> value{};
+	};
+
+	const u32 m_capacity;
+	const std::unique_ptr<slot[]> m_slots;
+
+	alignas(64) std::atomic<u64> m_free{};    ///< tag << 32 | index of the top free slot
+	alignas(64) std::atomic<slot *> m_arms{}; ///< MPSC list of arm requests
+	alignas(64) std::atomic<rep> m_wake_at{ std::numeric_limits<rep>::max() };
+	details::wait_point m_wakeup;
+
+	/// Owned by the polling thread
+	std::vector<entry> m_heap;
+	u64 m_order{};
+
+	std::atomic<bool> m_running{};
+	std::thread m_driver;
+
+	counter m_armed;
+	counter m_fired;
+	counter m_cancelled;
+	counter m_rejected;
+	counter m_unreleased; ///< Cancelled timers which slots aren't freed yet
+	std::atomic<u64> m_batches{};
+	std::atomic<u64> m_largest_batch{};
+
+	void link_slots();
+	[[nodiscard]] u32 acquire_slot() noexcept;
+	void release_slot(const u32 index) noexcept;
+	void drain();
+	void compact();
+	void drive();
+	void launch(const u32 core);
+
+	[[nodiscard]] u64 compaction_threshold() const noexcept;
+
+	[[nodiscard]] static bool later(const entry &lhs, const entry &rhs) noexcept;
+	[[nodiscard]] static constexpr u64 state_of(const u32 generation, const status value) noexcept;
+};
+
+/**
+ * @brief Where golxzn::os::chrono::sharded_timer_service arms timers. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono timer_service
+ */
+enum class timer_placement : u8 {
+	local,    ///< Timers fire on the shard of the core which armed them
+	balanced, ///< Like local, but timers migrate from an overloaded shard to the least loaded one
+};
+
+/**
+ * @brief Set of timer services with one shard and driver per core. (only when GOLXZN_MULTITHREADING is defined)
+ * @ingroup Chrono timer_service
+ * @details Every shard is a golxzn::os::chrono::timer_service with its own slots, heap and driver thread
+ * pinned to one of the available cores. `arm()` picks the shard of the core the calling thread runs on,
+ * so timers armed on a core are queued, fired and freed on that core and shards never share cache
+ * lines. Where the current core isn't known, each thread sticks to its own shard instead.
+ *
+ * With golxzn::os::chrono::timer_placement::balanced a timer migrates to the least loaded shard when
+ * the local one has twice as many pending timers. A full shard always hands the timer to the next one,
+ * so arming fails only when every shard is full. Handles remember their shard, so `cancel()` is routed
+ * straight to it.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::sharded_timer_service<> timers; // one shard per core, drivers are running
+ *
+ * // any I/O thread
+ * const auto timeout{ timers.arm(golxzn::os::chrono::milliseconds(500), [&connection] { connection.abort(); }) };
+ * ...
+ * if (reply_received) timers.cancel(timeout);
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic, STL compatible
+ * and have static `now()`.
+ */
+template<class BaseClock = utils::default_base_clock>
+class sharded_timer_service {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::sharded_timer_service] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::sharded_timer_service] BaseClock's resolution is less than microseconds!");
+	static_assert(utils::has_static_now_v<BaseClock>,
+		"[golxzn::os::chrono::sharded_timer_service] Driver threads require BaseClock with static now()");
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+	using shard_type = timer_service<BaseClock>;        ///< Type of the shard
+	using deadline_type = typename shard_type::deadline_type; ///< Deadline type
+	using callback = typename shard_type::callback;     ///< Timer callback type
+
+	/**
+	 * @brief Constructs shards and starts their drivers.
+	 * @param shards Number of shards. 0 means one per available core.
+	 * @param capacity Maximum number of timers armed at once in each shard.
+	 * @param placement Where timers are armed.
+	 */
+	explicit sharded_timer_service(const std::size_t shards = 0,
+		const std::size_t capacity = shard_type::default_capacity,
+		const timer_placement placement = timer_placement::local);
+
+	sharded_timer_service(const sharded_timer_service &) = delete;
+	sharded_timer_service &operator=(const sharded_timer_service &) = delete;
+
+	/**
+	 * @brief Stops every driver. Timers which haven't fired are dropped.
+	 */
+	~sharded_timer_service();
+
+	/**
+	 * @brief Arms timer on the shard of the calling thread. Could be called from any thread.
+	 * @return Invalid handle if all slots of all shards are busy.
+	 */
+	timer_handle arm(const deadline_type deadline, callback &&task);
+
+	/**
+	 * @brief Arms timer which fires after the interval.
+	 * @see arm(const deadline_type deadline, callback &&task)
+	 */
+	timer_handle arm(const time interval, callback &&task);
+
+	/**
+	 * @brief Arms timer which fires after the interval.
+	 * @see arm(const deadline_type deadline, callback &&task)
+	 */
+	template<class Rep, class Period>
+	timer_handle arm(const std::chrono::duration<Rep, Period> interval, callback &&task);
+
+	/**
+	 * @brief Arms timer on the given shard without migration.
+	 * @return Invalid handle if the shard doesn't exist or all its slots are busy.
+	 */
+	timer_handle arm_on(const std::size_t shard, const deadline_type deadline, callback &&task);
+
+	/**
+	 * @brief Cancels timer on the shard it was armed on. Could be called from any thread.
+	 * @see timer_service::cancel(const timer_handle handle)
+	 */
+	bool cancel(const timer_handle handle) noexcept;
+
+	/**
+	 * @brief Returns number of shards.
+	 */
+	[[nodiscard]] std::size_t shards() const noexcept;
+
+	/**
+	 * @brief Returns the shard of the core the calling thread runs on.
+	 */
+	[[nodiscard]] std::size_t local_shard() const noexcept;
+
+	/**
+	 * @brief Returns the core the driver of the shard is pinned to.
+	 */
+	[[nodiscard]] u32 core(const std::size_t shard) const noexcept;
+
+	/**
+	 * @brief Returns placement policy.
+	 */
+	[[nodiscard]] timer_placement placement() const noexcept;
+
+	/**
+	 * @brief Returns number of timers armed on another shard than the local one.
+	 */
+	[[nodiscard]] u64 migrated() const noexcept;
+
+	/**
+	 * @brief Returns statistics of the shard since construction.
+	 */
+	[[nodiscard]] timer_service_stats stats(const std::size_t shard) const noexcept;
+
+	/**
+	 * @brief Returns statistics of all shards: sums of counters and the largest batch of any shard.
+	 */
+	[[nodiscard]] timer_service_stats stats() const noexcept;
+
+private:
+	/// Below that number of pending timers a shard is never considered overloaded
+	static constexpr u64 migration_slack{ 64 };
+
+	std::vector<std::unique_ptr<shard_type>> m_shards;
+	std::vector<u32> m_cores;          ///< Core of each shard
+	std::vector<u32> m_shard_of_core;  ///< Shard of each core id
+	const timer_placement m_placement;
+	alignas(64) std::atomic<u64> m_migrated{};
+
+	[[nodiscard]] std::size_t target_shard(const std::size_t local) const noexcept;
+	[[nodiscard]] u64 pending(const std::size_t shard) const noexcept;
+	timer_handle arm_at(const std::size_t shard, const deadline_type deadline, callback &task);
+};
+
+namespace details {
+
+/**
+ * @brief Returns the core the calling thread runs on, or a stable per-thread number where it's unknown.
+ */
+[[nodiscard]] u32 current_core() noexcept;
+
+/**
+ * @brief Returns true if the calling thread is a driver thread of any golxzn::os::chrono::timer_service.
+ */
+[[nodiscard]] bool is_timer_driver() noexcept;
+
+/**
+ * @brief Marks the calling thread as a timer driver.
+ */
+void mark_timer_driver() noexcept;
+
+} // namespace details
+
+#include "golxzn/os/chrono/impl/timer_service.inl"
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono
@@ -32,6 +32,82 @@ struct enough_resolution : std::bool_constant<std::ratio_less_equal_v<typename C
 template<class Clock>
 static constexpr bool enough_resolution_v{ enough_resolution<Clock>::value };
 
+/**
+ * @brief Checks if Clock has static `now()` like STL clocks.
+ * @ingroup Chrono utilities
+ * @details Clocks without static `now()` are stateful: clocks and timers keep a reference to their instance.
+ */
+template<class Clock, class = void>
+struct has_static_now : std::false_type {};
+
+template<class Clock>
+struct has_static_now<Clock, std::void_t<decltype(Clock::now())>> : std::true_type {};
+
+template<class Clock>
+static constexpr bool has_static_now_v{ has_static_now<Clock>::value };
+
+/**
+ * @brief Checks if Clock is able to dispatch callbacks by itself.
+ * @ingroup Chrono utilities
+ * @details Such clock has to provide `task_id` type, `schedule(time_point, callback)` returning `task_id`
+ * and `cancel(task_id)`, which returns false only if the task has been taken to be called. Timers hand their
+ * callbacks to such clock instead of polling it.
+ * @see golxzn::os::chrono::manual_clock
+ */
+template<class Clock, class = void>
+struct scheduler_task { using type = void; };
+
+template<class Clock>
+struct scheduler_task<Clock, std::void_t<typename Clock::task_id>> { using type = typename Clock::task_id; };
+
+template<class Clock, class = void>
+struct has_scheduler : std::false_type {};
+
+template<class Clock>
+struct has_scheduler<Clock, std::void_t<
+	typename Clock::task_id,
+	decltype(std::declval<Clock &>().schedule(std::declval<typename Clock::time_point>(), std::declval<void(*)()>())),
+	decltype(std::declval<Clock &>().cancel(std::declval<typename Clock::task_id>()))
+>> : std::true_type {};
+
+template<class Clock>
+static constexpr bool has_scheduler_v{ has_scheduler<Clock>::value };
+
+/**
+ * @brief Base clock holder used by clocks and timers.
+ * @ingroup Chrono utilities
+ * @details For clocks with static `now()` it's empty and costs nothing.
+ * For stateful clocks it keeps a pointer to the clock instance.
+ * @tparam BaseClock clock that will be used for measurement.
+ * @see golxzn::os::chrono::utils::has_static_now
+ */
+template<class BaseClock, bool Stateless = has_static_now_v<BaseClock>>
+class base_clock_ref {
+public:
+	using time_point = typename BaseClock::time_point;
+
+	constexpr base_clock_ref() noexcept = default;
+	explicit constexpr base_clock_ref(BaseClock &) noexcept {}
+
+	[[nodiscard]] static time_point now() noexcept(noexcept(BaseClock::now())) { return BaseClock::now(); }
+};
+
+template<class BaseClock>
+class base_clock_ref<BaseClock, false> {
+public:
+	using time_point = typename BaseClock::time_point;
+
+	explicit constexpr base_clock_ref(BaseClock &clock) noexcept : m_clock{ &clock } {}
+
+	[[nodiscard]] time_point now() const noexcept(noexcept(std::declval<const BaseClock &>().now())) {
+		return m_clock->now();
+	}
+	[[nodiscard]] BaseClock &base() const noexcept { return *m_clock; }
+
+private:
+	BaseClock *m_clock;
+};
+
 /**
  * @brief Time difference between two time points
  * @ingroup Chrono utilities
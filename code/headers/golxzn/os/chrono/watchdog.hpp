@@ -0,0 +1,194 @@
+/**
+ * @file golxzn/os/chrono/watchdog.hpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Stall watchdog which monitors worker heartbeats
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <functional>
+#include <string_view>
+
+#if defined(GOLXZN_MULTITHREADING)
+#include <thread>
+#include <condition_variable>
+#endif // defined(GOLXZN_MULTITHREADING)
+
+#include "golxzn/os/chrono/utils.hpp"
+#include "golxzn/os/chrono/time.hpp"
+#include "golxzn/os/chrono/timer.hpp"
+
+namespace golxzn::os::chrono {
+
+/**
+ * @brief Detects workers which haven't reported for longer than the threshold.
+ * @ingroup Chrono watchdog
+ * @details Each worker registers itself with `add()` and calls `heartbeat()` on the returned handle.
+ * Heartbeat doesn't read the clock: it copies the timestamp cached by the last scan into the worker slot
+ * with relaxed atomics, so it costs two plain loads and a store. Scans refresh the cached timestamp,
+ * check all slots and call the stall handler once per stall with the time the worker has been silent.
+ * Because of caching, the detection precision is the scan interval.
+ *
+ * If `GOLXZN_MULTITHREADING` is defined, `start()` runs the monitor thread which scans every scan interval
+ * using golxzn::os::chrono::fast_timer. Otherwise (or with stateful clocks like golxzn::os::chrono::manual_clock)
+ * `scan()` has to be called manually.
+ *
+ * Usage:
+ * @code{.cpp}
+ * golxzn::os::chrono::watchdog<> dog{ golxzn::os::chrono::milliseconds(500),
+ * 	[](std::string_view name, golxzn::os::chrono::time silent) {
+ * 		std::cerr << name << " is stuck for " << silent.milliseconds() << "ms\n";
+ * 	}
+ * };
+ * dog.start();
+ *
+ * std::thread worker{ [&dog] {
+ * 	auto beat{ dog.add("worker") };
+ * 	while (running) {
+ * 		beat.heartbeat();
+ * 		process();
+ * 	}
+ * } };
+ * @endcode
+ * @tparam BaseClock clock that will be used for measurement. It has to be monotonic and STL compatible.
+ */
+template<class BaseClock = utils::default_base_clock>
+class watchdog : private utils::base_clock_ref<BaseClock> {
+	static_assert(BaseClock::is_steady,
+		"[golxzn::os::chrono::watchdog] BaseClock is not a monotonic clock");
+	static_assert(utils::enough_resolution_v<BaseClock>,
+		"[golxzn::os::chrono::watchdog] BaseClock's resolution is less than microseconds!");
+
+	struct slot;
+
+public:
+	using base_clock = BaseClock;                       ///< Base clock type
+	using time_point = typename base_clock::time_point; ///< Type of time point from base_clock
+	using stall_handler = std::function<void(std::string_view name, time silent)>; ///< Stall callback type
+
+	/**
+	 * @brief Worker registration handle.
+	 * @details Unregisters the worker on destruction.
+	 */
+	class worker {
+	public:
+		worker() noexcept = default;
+		worker(worker &&other) noexcept;
+		worker &operator=(worker &&other) noexcept;
+		worker(const worker &) = delete;
+		worker &operator=(const worker &) = delete;
+		~worker();
+
+		/**
+		 * @brief Reports that the worker is alive. Wait-free and doesn't read the clock.
+		 */
+		void heartbeat() const noexcept;
+
+		/**
+		 * @brief Returns true if handle is registered in a watchdog.
+		 */
+		[[nodiscard]] bool valid() const noexcept;
+
+	private:
+		friend class watchdog;
+		worker(watchdog *owner, slot *target) noexcept;
+
+		watchdog *m_owner{};
+		slot *m_slot{};
+	};
+
+	/**
+	 * @brief Watchdog constructor.
+	 * @ingroup Chrono watchdog construction
+	 * @param threshold Silence duration after which worker is considered stalled.
+	 * @param handler Function that will be called once per stall.
+	 * @param scan_interval Interval of monitor scans. By default it's a quarter of the threshold.
+	 */
+	watchdog(const time threshold, stall_handler &&handler, const time scan_interval = time::zero());
+
+	/**
+	 * @brief Watchdog constructor from base clock instance.
+	 * @ingroup Chrono watchdog construction
+	 * @details Required for stateful base clocks (e.g. golxzn::os::chrono::manual_clock).
+	 * @warning The base clock instance has to outlive this watchdog.
+	 * @see watchdog(const time threshold, stall_handler &&handler, const time scan_interval)
+	 */
+	watchdog(base_clock &base, const time threshold, stall_handler &&handler, const time scan_interval = time::zero());
+
+	watchdog(const watchdog &) = delete;
+	watchdog &operator=(const watchdog &) = delete;
+	~watchdog();
+
+	/**
+	 * @brief Registers worker. Its silence is counted since registration.
+	 * @param name Worker name which is passed to the stall handler.
+	 * @return Worker handle. All handles has to be destroyed before the watchdog.
+	 */
+	[[nodiscard]] worker add(std::string name);
+
+	/**
+	 * @brief Refreshes cached timestamp and checks all workers.
+	 * @return Number of workers which are stalled now.
+	 */
+	std::size_t scan();
+
+	/**
+	 * @brief Returns interval of monitor scans.
+	 */
+	[[nodiscard]] time scan_interval() const noexcept;
+
+#if defined(GOLXZN_MULTITHREADING)
+	/**
+	 * @brief Starts monitor thread which calls scan() every scan interval. (only when GOLXZN_MULTITHREADING is defined)
+	 */
+	void start();
+
+	/**
+	 * @brief Stops monitor thread. (only when GOLXZN_MULTITHREADING is defined)
+	 */
+	void stop();
+#endif // defined(GOLXZN_MULTITHREADING)
+
+private:
+	using clock_ref = utils::base_clock_ref<BaseClock>;
+
+	struct alignas(64) slot {
+		std::atomic<i64> last_beat{};
+		std::atomic<bool> active{};
+		i64 reported_beat{};
+		bool reported{};
+		std::string name;
+	};
+
+	const time m_threshold;
+	const time m_scan_interval;
+	const stall_handler m_handler;
+
+	alignas(64) std::atomic<i64> m_cached_now{};
+
+	std::mutex m_slots_mutex;
+	std::deque<slot> m_slots;
+	std::vector<slot *> m_free_slots;
+
+#if defined(GOLXZN_MULTITHREADING)
+	std::mutex m_monitor_mutex;
+	std::condition_variable m_monitor_wakeup;
+	bool m_monitor_running{};
+	std::thread m_monitor;
+#endif // defined(GOLXZN_MULTITHREADING)
+
+	[[nodiscard]] i64 current() const noexcept;
+	void remove(slot *target);
+};
+
+#include "golxzn/os/chrono/impl/watchdog.inl"
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,287 @@
+#include "golxzn/os/chrono/auto_clock.hpp"
+
+#include <mutex>
+#include <thread>
+#include <limits>
+#include <algorithm>
+
+#if defined(GXZN_CHRONO_LINUX)
+#include <ctime>
+#endif // defined(GXZN_CHRONO_LINUX)
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define GXZN_CHRONO_CYCLE_COUNTER_X86
+#elif defined(_M_X64) && defined(_MSC_VER)
+#include <intrin.h>
+#define GXZN_CHRONO_CYCLE_COUNTER_X86
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define GXZN_CHRONO_CYCLE_COUNTER_ARM
+#endif
+
+namespace golxzn::os::chrono {
+
+namespace {
+
+using rep = auto_clock::rep;
+using read_function = rep (*)() noexcept;
+
+rep read_steady() noexcept {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(GXZN_CHRONO_LINUX)
+
+template<clockid_t Id>
+rep read_posix() noexcept {
+	timespec value{};
+	clock_gettime(Id, &value);
+	return static_cast<rep>(value.tv_sec) * 1'000'000'000 + static_cast<rep>(value.tv_nsec);
+}
+
+template<clockid_t Id>
+std::chrono::nanoseconds reported_resolution() noexcept {
+	timespec value{};
+	if (clock_getres(Id, &value) != 0) return std::chrono::nanoseconds::max();
+	return std::chrono::seconds{ value.tv_sec } + std::chrono::nanoseconds{ value.tv_nsec };
+}
+
+#endif // defined(GXZN_CHRONO_LINUX)
+
+#if defined(GXZN_CHRONO_CYCLE_COUNTER_X86) || defined(GXZN_CHRONO_CYCLE_COUNTER_ARM)
+
+#if defined(GXZN_CHRONO_CYCLE_COUNTER_X86)
+
+u64 read_counter() noexcept {
+	return __rdtsc();
+}
+
+bool counter_is_invariant() noexcept {
+	/// CPUID.80000007H:EDX[8] - TSC runs at constant rate in all power states
+#if defined(_MSC_VER)
+	int registers[4]{};
+	__cpuid(registers, static_cast<int>(0x80000000));
+	if (static_cast<u32>(registers[0]) < 0x80000007) return false;
+	__cpuid(registers, static_cast<int>(0x80000007));
+	return (static_cast<u32>(registers[3]) & (1u << 8)) != 0;
+#else
+	unsigned eax{}, ebx{}, ecx{}, edx{};
+	if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) return false;
+	if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) return false;
+	return (edx & (1u << 8)) != 0;
+#endif // defined(_MSC_VER)
+}
+
+#else
+
+u64 read_counter() noexcept {
+	u64 value{};
+	asm volatile("isb; mrs %0, cntvct_el0" : "=r"(value) :: "memory");
+	return value;
+}
+
+bool counter_is_invariant() noexcept {
+	return true; // the generic timer ticks at the fixed CNTFRQ_EL0 frequency by architecture
+}
+
+#endif // defined(GXZN_CHRONO_CYCLE_COUNTER_X86)
+
+/// Fixed point conversion: ns = ticks * multiplier >> shift, split so the product never overflows
+constexpr u32 counter_shift{ 24 };
+constexpr u64 counter_low_mask{ (u64{ 1 } << counter_shift) - 1 };
+
+struct counter_calibration {
+	u64 base{};
+	rep offset{};
+	u64 multiplier{};
+};
+counter_calibration calibration{};
+
+rep read_cycle_counter() noexcept {
+	const auto ticks{ read_counter() - calibration.base };
+	const auto nanoseconds{ (ticks >> counter_shift) * calibration.multiplier
+		+ (((ticks & counter_low_mask) * calibration.multiplier) >> counter_shift) };
+	return calibration.offset + static_cast<rep>(nanoseconds);
+}
+
+struct counter_sample {
+	rep time{};  ///< Steady time of the counter read
+	u64 ticks{};
+	rep gap{ std::numeric_limits<rep>::max() }; ///< Steady time between reads around it, i.e. the error of time
+};
+
+/// Brackets the counter read with steady reads, so preemption between them shows up as a wide gap
+counter_sample sample_counter() noexcept {
+	constexpr u32 attempts{ 16 };
+
+	counter_sample best{};
+	for (u32 attempt{}; attempt < attempts; ++attempt) {
+		const auto before{ read_steady() };
+		const auto ticks{ read_counter() };
+		const auto after{ read_steady() };
+		if (after - before < best.gap) {
+			best = counter_sample{ before + (after - before) / 2, ticks, after - before };
+		}
+	}
+	return best;
+}
+
+/// Measures the counter frequency against steady_clock in the most precise of several windows
+bool calibrate_counter() noexcept {
+	if (!counter_is_invariant()) return false;
+
+	constexpr u32 windows{ 3 };
+	constexpr std::chrono::milliseconds span{ 10 };
+	constexpr rep widest_gap{ 20'000 }; // ns; a wider one means the sample was interrupted
+
+	counter_sample start, end;
+	auto error{ std::numeric_limits<rep>::max() };
+	for (u32 window{}; window < windows; ++window) {
+		const auto window_start{ sample_counter() };
+		std::this_thread::sleep_for(span);
+		const auto window_end{ sample_counter() };
+		if (window_start.gap > widest_gap || window_end.gap > widest_gap) continue;
+
+		if (const auto window_error{ window_start.gap + window_end.gap }; window_error < error) {
+			error = window_error;
+			start = window_start;
+			end = window_end;
+		}
+	}
+	if (error == std::numeric_limits<rep>::max()) return false;
+
+	const auto elapsed{ static_cast<u64>(end.time - start.time) };
+	const auto ticks{ end.ticks - start.ticks };
+	if (elapsed == 0 || ticks <= elapsed / 1000) return false; // slower than 1 MHz isn't worth it
+
+	const auto multiplier{ static_cast<u64>(
+		static_cast<f64>(elapsed) / static_cast<f64>(ticks) * static_cast<f64>(u64{ 1 } << counter_shift)) };
+	if (multiplier == 0 || multiplier > (u64{ 1 } << 40)) return false;
+
+	calibration = counter_calibration{ end.ticks, end.time, multiplier };
+	return true;
+}
+
+#endif // defined(GXZN_CHRONO_CYCLE_COUNTER_X86) || defined(GXZN_CHRONO_CYCLE_COUNTER_ARM)
+
+struct candidate {
+	clock_source source;
+	read_function read;
+	std::chrono::nanoseconds reported;
+};
+
+std::vector<candidate> candidates() {
+	std::vector<candidate> result;
+	result.push_back(candidate{ clock_source::steady, &read_steady,
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::duration{ 1 }) });
+#if defined(GXZN_CHRONO_LINUX)
+	result.push_back(candidate{ clock_source::monotonic_raw, &read_posix<CLOCK_MONOTONIC_RAW>,
+		reported_resolution<CLOCK_MONOTONIC_RAW>() });
+	result.push_back(candidate{ clock_source::monotonic_coarse, &read_posix<CLOCK_MONOTONIC_COARSE>,
+		reported_resolution<CLOCK_MONOTONIC_COARSE>() });
+#endif // defined(GXZN_CHRONO_LINUX)
+#if defined(GXZN_CHRONO_CYCLE_COUNTER_X86) || defined(GXZN_CHRONO_CYCLE_COUNTER_ARM)
+	if (calibrate_counter()) {
+		result.push_back(candidate{ clock_source::cycle_counter, &read_cycle_counter, std::chrono::nanoseconds{ 1 } });
+	}
+#endif // defined(GXZN_CHRONO_CYCLE_COUNTER_X86) || defined(GXZN_CHRONO_CYCLE_COUNTER_ARM)
+	return result;
+}
+
+clock_probe measure(const candidate &target) noexcept {
+	constexpr u32 reads{ 1000 };
+	constexpr rep step_search{ 200'000 }; // ns of steady time spent looking for the smallest step
+
+	clock_probe probe{ target.source, target.reported != std::chrono::nanoseconds::max() };
+	if (!probe.available) return probe;
+
+	const auto start{ read_steady() };
+	for (u32 i{}; i < reads; ++i) {
+		(void)target.read(); // called through a pointer, so it can't be optimized out
+	}
+	probe.cost = static_cast<f64>(read_steady() - start) / reads;
+
+	auto smallest{ std::numeric_limits<rep>::max() };
+	auto previous{ target.read() };
+	const auto search_end{ read_steady() + step_search };
+	while (read_steady() < search_end) {
+		const auto current{ target.read() };
+		if (current < previous) { // not monotonic on this host
+			probe.available = false;
+			return probe;
+		}
+		if (current != previous) smallest = std::min(smallest, current - previous);
+		previous = current;
+	}
+	/// Coarse sources may not step within the search, their reported resolution is used then
+	probe.resolution = smallest != std::numeric_limits<rep>::max()
+		? std::max(std::chrono::nanoseconds{ smallest }, target.reported)
+		: target.reported;
+	return probe;
+}
+
+struct selection {
+	std::once_flag once;
+	clock_source source{ clock_source::steady };
+	read_function read{ &read_steady };
+	std::vector<clock_probe> probes;
+};
+
+selection &selected() {
+	static selection instance;
+	return instance;
+}
+
+} // namespace
+
+std::string_view name_of(const clock_source source) noexcept {
+	switch (source) {
+		case clock_source::steady: return "steady";
+		case clock_source::monotonic_raw: return "monotonic_raw";
+		case clock_source::monotonic_coarse: return "monotonic_coarse";
+		case clock_source::cycle_counter: return "cycle_counter";
+	}
+	return "unknown";
+}
+
+std::atomic<auto_clock::read_function> auto_clock::s_read{ &auto_clock::select_and_read };
+
+bool auto_clock::select(const std::chrono::nanoseconds resolution) {
+	auto &target{ selected() };
+	bool selected_here{};
+	std::call_once(target.once, [&target, &selected_here, resolution] {
+		selected_here = true;
+
+		f64 cheapest{ std::numeric_limits<f64>::max() };
+		for (const auto &entry : candidates()) {
+			const auto probe{ measure(entry) };
+			target.probes.push_back(probe);
+			if (!probe.available || probe.resolution > resolution || probe.cost >= cheapest) continue;
+
+			cheapest = probe.cost;
+			target.source = entry.source;
+			target.read = entry.read;
+		}
+		s_read.store(target.read, std::memory_order_release);
+	});
+	return selected_here;
+}
+
+clock_source auto_clock::source() {
+	select();
+	return selected().source;
+}
+
+const std::vector<clock_probe> &auto_clock::probes() {
+	select();
+	return selected().probes;
+}
+
+auto_clock::rep auto_clock::select_and_read() noexcept {
+	select();
+	return selected().read();
+}
+
+} // namespace golxzn::os::chrono
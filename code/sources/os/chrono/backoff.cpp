@@ -0,0 +1,83 @@
+#include "golxzn/os/chrono/backoff.hpp"
+
+#include <atomic>
+#include <algorithm>
+
+namespace golxzn::os::chrono {
+
+namespace {
+
+/// splitmix64 step: tiny state, so every operation could own a generator
+u64 mix(u64 &state) noexcept {
+	u64 value{ state += 0x9E3779B97F4A7C15ULL };
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+u64 unique_seed() noexcept {
+	/// Backoffs created at the same time by different clients must not produce the same delays
+	static std::atomic<u64> counter{};
+	u64 seed{ static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count())
+		^ (counter.fetch_add(1, std::memory_order_relaxed) * 0xD1B54A32D192ED03ULL) };
+	return mix(seed);
+}
+
+} // namespace
+
+backoff::backoff(const backoff_policy &policy, const u64 seed) noexcept
+	: m_policy{ policy }
+	, m_state{ seed != 0 ? seed : unique_seed() } {
+	m_policy.initial = std::max(m_policy.initial, time{});
+	m_policy.cap = std::max(m_policy.cap, m_policy.initial);
+	m_policy.multiplier = std::max(m_policy.multiplier, 1.0);
+	reset();
+}
+
+time backoff::next() noexcept {
+	const auto initial{ static_cast<f64>(m_policy.initial.microseconds()) };
+	const auto cap{ static_cast<f64>(m_policy.cap.microseconds()) };
+
+	f64 delay{};
+	switch (m_policy.jitter) {
+		case backoff_jitter::none:
+			delay = m_window;
+			break;
+		case backoff_jitter::full:
+			delay = uniform(0.0, m_window);
+			break;
+		case backoff_jitter::decorrelated:
+			delay = std::min(cap, uniform(initial, std::max(initial, m_previous * m_policy.multiplier)));
+			break;
+	}
+	m_window = std::min(cap, m_window * m_policy.multiplier);
+	m_previous = delay;
+	++m_retries;
+	return microseconds(static_cast<i64>(delay));
+}
+
+void backoff::reset() noexcept {
+	m_window = static_cast<f64>(m_policy.initial.microseconds());
+	m_previous = m_window;
+	m_retries = 0;
+}
+
+u32 backoff::retries() const noexcept {
+	return m_retries;
+}
+
+bool backoff::exhausted() const noexcept {
+	return m_policy.max_retries != 0 && m_retries >= m_policy.max_retries;
+}
+
+const backoff_policy &backoff::policy() const noexcept {
+	return m_policy;
+}
+
+f64 backoff::uniform(const f64 from, const f64 to) noexcept {
+	/// 53 random bits make a double in [0, 1)
+	const auto unit{ static_cast<f64>(mix(m_state) >> 11) * (1.0 / static_cast<f64>(u64{ 1 } << 53)) };
+	return from + (to - from) * unit;
+}
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,197 @@
+#include <cmath>
+#include <random>
+#include <numeric>
+#include <cstdio>
+#include <charconv>
+
+#include "golxzn/os/chrono/bench.hpp"
+
+namespace golxzn::os::chrono::bench {
+
+namespace {
+
+/// Scale factor which makes MAD a consistent estimator of standard deviation for normal distribution
+constexpr f64 mad_to_sigma{ 1.4826 };
+
+[[nodiscard]] f64 median_of(std::vector<f64> &values) {
+	if (values.empty()) return 0.0;
+
+	const auto middle{ std::begin(values) + values.size() / 2 };
+	std::nth_element(std::begin(values), middle, std::end(values));
+	if (values.size() % 2 != 0) return *middle;
+
+	const auto lower{ *std::max_element(std::begin(values), middle) };
+	return (lower + *middle) / 2.0;
+}
+
+[[nodiscard]] f64 mad_of(const std::vector<f64> &values, const f64 median, std::vector<f64> &scratch) {
+	scratch.resize(values.size());
+	std::transform(std::begin(values), std::end(values), std::begin(scratch),
+		[median](const f64 value) { return std::abs(value - median); });
+	return median_of(scratch);
+}
+
+[[nodiscard]] f64 mean_of(const std::vector<f64> &values) {
+	if (values.empty()) return 0.0;
+	return std::accumulate(std::begin(values), std::end(values), 0.0) / static_cast<f64>(values.size());
+}
+
+[[nodiscard]] f64 percentile(std::vector<f64> &values, const f64 fraction) {
+	if (values.empty()) return 0.0;
+
+	const auto index{ static_cast<std::size_t>(
+		std::clamp(fraction, 0.0, 1.0) * static_cast<f64>(values.size() - 1) + 0.5
+	) };
+	const auto nth{ std::begin(values) + index };
+	std::nth_element(std::begin(values), nth, std::end(values));
+	return *nth;
+}
+
+void append(std::string &out, const f64 value) {
+	if (!std::isfinite(value)) {
+		out.append("null");
+		return;
+	}
+	char buffer[32];
+	const auto length{ std::snprintf(buffer, sizeof(buffer), "%.17g", value) };
+	out.append(buffer, static_cast<std::size_t>(std::max(length, 0)));
+}
+
+void append(std::string &out, const std::size_t value) {
+	char buffer[24];
+	const auto [end, error]{ std::to_chars(std::begin(buffer), std::end(buffer), value) };
+	out.append(buffer, end);
+}
+
+void append(std::string &out, const estimate &value) {
+	out.append(R"({"value":)");
+	append(out, value.point);
+	out.append(R"(,"lower":)");
+	append(out, value.lower);
+	out.append(R"(,"upper":)");
+	append(out, value.upper);
+	out.push_back('}');
+}
+
+void append_escaped(std::string &out, const std::string_view text) {
+	static constexpr char hex[]{ "0123456789abcdef" };
+	out.push_back('"');
+	for (const auto symbol : text) {
+		switch (symbol) {
+			case '"':  out.append(R"(\")"); break;
+			case '\\': out.append(R"(\\)"); break;
+			case '\n': out.append(R"(\n)"); break;
+			case '\t': out.append(R"(\t)"); break;
+			default:
+				if (static_cast<unsigned char>(symbol) < 0x20) {
+					out.append(R"(\u00)");
+					out.push_back(hex[(symbol >> 4) & 0xF]);
+					out.push_back(hex[symbol & 0xF]);
+				} else {
+					out.push_back(symbol);
+				}
+				break;
+		}
+	}
+	out.push_back('"');
+}
+
+} // anonymous namespace
+
+time estimate::value() const noexcept {
+	return time{ std::chrono::duration<f64, std::nano>{ point } };
+}
+
+result analyze(std::vector<f64> samples, const std::size_t iterations, const f64 overhead, const options &opts) {
+	result stats;
+	stats.iterations = std::max(iterations, std::size_t{ 1 });
+	stats.overhead = overhead;
+	stats.total = time{ std::chrono::duration<f64, std::nano>{
+		std::accumulate(std::begin(samples), std::end(samples), 0.0)
+	} };
+
+	const auto per_iteration{ static_cast<f64>(stats.iterations) };
+	for (auto &value : samples) {
+		value /= per_iteration;
+	}
+
+	/// Outliers rejection by modified z-score (Iglewicz and Hoaglin)
+	std::vector<f64> scratch{ samples };
+	const auto median{ median_of(scratch) };
+	const auto deviation{ mad_to_sigma * mad_of(samples, median, scratch) };
+	if (deviation > 0.0) {
+		const auto outliers{ std::remove_if(std::begin(samples), std::end(samples), [&](const f64 value) {
+			return std::abs(value - median) / deviation > opts.outlier_threshold;
+		}) };
+		stats.outliers = static_cast<std::size_t>(std::distance(outliers, std::end(samples)));
+		samples.erase(outliers, std::end(samples));
+	}
+	stats.samples = samples.size();
+	if (samples.empty()) return stats;
+
+	scratch = samples;
+	stats.mean.point = mean_of(samples);
+	stats.median.point = median_of(scratch);
+	stats.mad.point = mad_of(samples, stats.median.point, scratch);
+
+	/// Percentile bootstrap of all three statistics
+	const auto resamples{ std::max(opts.resamples, std::size_t{ 1 }) };
+	std::vector<f64> means(resamples);
+	std::vector<f64> medians(resamples);
+	std::vector<f64> mads(resamples);
+	std::vector<f64> resample(samples.size());
+
+	std::mt19937_64 random{ opts.seed };
+	std::uniform_int_distribution<std::size_t> pick{ 0, samples.size() - 1 };
+	for (std::size_t i{}; i < resamples; ++i) {
+		for (auto &value : resample) {
+			value = samples[pick(random)];
+		}
+		means[i] = mean_of(resample);
+		scratch = resample;
+		medians[i] = median_of(scratch);
+		mads[i] = mad_of(resample, medians[i], scratch);
+	}
+
+	const auto tail{ (1.0 - std::clamp(opts.confidence, 0.0, 1.0)) / 2.0 };
+	const auto interval{ [tail](std::vector<f64> &values, estimate &target) {
+		target.lower = percentile(values, tail);
+		target.upper = percentile(values, 1.0 - tail);
+	} };
+	interval(means, stats.mean);
+	interval(medians, stats.median);
+	interval(mads, stats.mad);
+
+	return stats;
+}
+
+std::string to_json(const result &stats, const std::string_view name) {
+	std::string out;
+	out.reserve(320 + name.size());
+	out.push_back('{');
+	if (!name.empty()) {
+		out.append(R"("name":)");
+		append_escaped(out, name);
+		out.push_back(',');
+	}
+	out.append(R"("unit":"ns","iterations":)");
+	append(out, stats.iterations);
+	out.append(R"(,"samples":)");
+	append(out, stats.samples);
+	out.append(R"(,"outliers":)");
+	append(out, stats.outliers);
+	out.append(R"(,"overhead":)");
+	append(out, stats.overhead);
+	out.append(R"(,"total":)");
+	append(out, static_cast<f64>(stats.total.microseconds()) * 1000.0);
+	out.append(R"(,"mean":)");
+	append(out, stats.mean);
+	out.append(R"(,"median":)");
+	append(out, stats.median);
+	out.append(R"(,"mad":)");
+	append(out, stats.mad);
+	out.push_back('}');
+	return out;
+}
+
+} // namespace golxzn::os::chrono::bench
@@ -0,0 +1,93 @@
+#include "golxzn/os/chrono/bounded_queue.hpp"
+
+#if defined(GOLXZN_MULTITHREADING) && defined(GXZN_CHRONO_LINUX)
+#include <ctime>
+#include <climits>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif // defined(GOLXZN_MULTITHREADING) && defined(GXZN_CHRONO_LINUX)
+
+namespace golxzn::os::chrono::details {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+u32 wait_point::prepare() noexcept {
+	m_waiters.fetch_add(1, std::memory_order_relaxed);
+	/// Pairs with the fence in notify(): either the waiter sees the new data or the notifier sees the waiter
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	return m_epoch.load(std::memory_order_relaxed);
+}
+
+void wait_point::finish() noexcept {
+	m_waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void wait_point::notify_one() noexcept {
+	notify(false);
+}
+
+void wait_point::notify_all() noexcept {
+	notify(true);
+}
+
+#if defined(GXZN_CHRONO_LINUX)
+
+void wait_point::wait(const u32 epoch, const std::chrono::nanoseconds timeout) noexcept {
+	if (timeout <= timeout.zero()) return;
+
+	timespec relative{};
+	timespec *limit{};
+	if (timeout != std::chrono::nanoseconds::max()) {
+		const auto seconds{ std::chrono::duration_cast<std::chrono::seconds>(timeout) };
+		relative.tv_sec = static_cast<std::time_t>(seconds.count());
+		relative.tv_nsec = static_cast<long>((timeout - seconds).count());
+		limit = &relative;
+	}
+	/// Returns immediately if the epoch has been changed after prepare()
+	syscall(SYS_futex, reinterpret_cast<u32 *>(&m_epoch), FUTEX_WAIT_PRIVATE, epoch, limit, nullptr, 0);
+}
+
+void wait_point::notify(const bool all) noexcept {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_waiters.load(std::memory_order_relaxed) == 0) return;
+
+	m_epoch.fetch_add(1, std::memory_order_relaxed);
+	syscall(SYS_futex, reinterpret_cast<u32 *>(&m_epoch), FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, nullptr, nullptr, 0);
+}
+
+#else
+
+void wait_point::wait(const u32 epoch, const std::chrono::nanoseconds timeout) noexcept {
+	if (timeout <= timeout.zero()) return;
+
+	std::unique_lock lock{ m_mutex };
+	const auto changed{ [this, epoch] { return m_epoch.load(std::memory_order_relaxed) != epoch; } };
+	if (timeout == std::chrono::nanoseconds::max()) {
+		m_condition.wait(lock, changed);
+	} else {
+		m_condition.wait_for(lock, timeout, changed);
+	}
+}
+
+void wait_point::notify(const bool all) noexcept {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_waiters.load(std::memory_order_relaxed) == 0) return;
+
+	{
+		/// Changing the epoch under the lock guarantees the waiter either sees it or already sleeps
+		std::lock_guard lock{ m_mutex };
+		m_epoch.fetch_add(1, std::memory_order_relaxed);
+	}
+	if (all) {
+		m_condition.notify_all();
+	} else {
+		m_condition.notify_one();
+	}
+}
+
+#endif // defined(GXZN_CHRONO_LINUX)
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono::details
@@ -0,0 +1,230 @@
+#include <limits>
+#include <algorithm>
+
+#include "golxzn/os/chrono/bulk.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#	define GXZN_CHRONO_BULK_AVX2 1
+#	define GXZN_CHRONO_TARGET_AVX2 __attribute__((target("avx2")))
+#	include <immintrin.h>
+#elif defined(__AVX2__)
+#	define GXZN_CHRONO_BULK_AVX2 1
+#	define GXZN_CHRONO_TARGET_AVX2
+#	include <immintrin.h>
+#endif
+
+namespace golxzn::os::chrono::bulk {
+
+static_assert(sizeof(time) == sizeof(i64) && alignof(time) == alignof(i64),
+	"[golxzn::os::chrono::bulk] time has to be layout compatible with i64");
+static_assert(std::is_trivially_copyable_v<time> && std::is_standard_layout_v<time>,
+	"[golxzn::os::chrono::bulk] time has to be trivially copyable");
+
+namespace {
+
+void add_scalar(time *values, const std::size_t count, const i64 offset) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		values[i] = time{ values[i].microseconds() + offset };
+	}
+}
+
+void clamp_scalar(time *values, const std::size_t count, const i64 low, const i64 high) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		values[i] = time{ std::clamp(values[i].microseconds(), low, high) };
+	}
+}
+
+i64 min_scalar(const time *values, const std::size_t count, i64 result) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		result = std::min(result, values[i].microseconds());
+	}
+	return result;
+}
+
+i64 max_scalar(const time *values, const std::size_t count, i64 result) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		result = std::max(result, values[i].microseconds());
+	}
+	return result;
+}
+
+i64 sum_scalar(const time *values, const std::size_t count, i64 result) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		result += values[i].microseconds();
+	}
+	return result;
+}
+
+#if defined(GXZN_CHRONO_BULK_AVX2)
+
+/// time is layout compatible with i64, so 4 values fit into one 256-bit lane.
+/// Unaligned load/store intrinsics are allowed to alias any type.
+constexpr std::size_t avx2_width{ 4 };
+
+bool avx2_supported() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	static const bool supported{ [] {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}() };
+	return supported;
+#else
+	return true;
+#endif
+}
+
+GXZN_CHRONO_TARGET_AVX2
+void add_avx2(time *values, const std::size_t count, const i64 offset) noexcept {
+	const __m256i delta{ _mm256_set1_epi64x(offset) };
+	std::size_t i{};
+	for (; i + avx2_width <= count; i += avx2_width) {
+		auto *lane{ reinterpret_cast<__m256i *>(values + i) };
+		_mm256_storeu_si256(lane, _mm256_add_epi64(_mm256_loadu_si256(lane), delta));
+	}
+	add_scalar(values + i, count - i, offset);
+}
+
+GXZN_CHRONO_TARGET_AVX2
+void clamp_avx2(time *values, const std::size_t count, const i64 low, const i64 high) noexcept {
+	const __m256i lo{ _mm256_set1_epi64x(low) };
+	const __m256i hi{ _mm256_set1_epi64x(high) };
+	std::size_t i{};
+	for (; i + avx2_width <= count; i += avx2_width) {
+		auto *lane{ reinterpret_cast<__m256i *>(values + i) };
+		__m256i value{ _mm256_loadu_si256(lane) };
+		value = _mm256_blendv_epi8(value, lo, _mm256_cmpgt_epi64(lo, value));
+		value = _mm256_blendv_epi8(value, hi, _mm256_cmpgt_epi64(value, hi));
+		_mm256_storeu_si256(lane, value);
+	}
+	clamp_scalar(values + i, count - i, low, high);
+}
+
+template<bool Min>
+GXZN_CHRONO_TARGET_AVX2
+i64 extremum_avx2(const time *values, const std::size_t count, const i64 init) noexcept {
+	__m256i result{ _mm256_set1_epi64x(init) };
+	std::size_t i{};
+	for (; i + avx2_width <= count; i += avx2_width) {
+		const __m256i value{ _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)) };
+		const __m256i replace{ Min ? _mm256_cmpgt_epi64(result, value) : _mm256_cmpgt_epi64(value, result) };
+		result = _mm256_blendv_epi8(result, value, replace);
+	}
+
+	alignas(32) i64 lanes[avx2_width];
+	_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), result);
+	i64 reduced{ init };
+	for (const auto lane : lanes) {
+		reduced = Min ? std::min(reduced, lane) : std::max(reduced, lane);
+	}
+	return Min
+		? min_scalar(values + i, count - i, reduced)
+		: max_scalar(values + i, count - i, reduced);
+}
+
+GXZN_CHRONO_TARGET_AVX2
+i64 sum_avx2(const time *values, const std::size_t count) noexcept {
+	__m256i result{ _mm256_setzero_si256() };
+	std::size_t i{};
+	for (; i + avx2_width <= count; i += avx2_width) {
+		result = _mm256_add_epi64(result, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)));
+	}
+
+	alignas(32) i64 lanes[avx2_width];
+	_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), result);
+	return sum_scalar(values + i, count - i, lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+
+} // anonymous namespace
+
+void to_seconds(const time *values, const std::size_t count, f32 *out) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		out[i] = values[i].seconds<f32>();
+	}
+}
+
+void to_seconds(const time *values, const std::size_t count, f64 *out) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		out[i] = values[i].seconds<f64>();
+	}
+}
+
+void to_milliseconds(const time *values, const std::size_t count, i32 *out) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		out[i] = values[i].milliseconds();
+	}
+}
+
+void to_microseconds(const time *values, const std::size_t count, i64 *out) noexcept {
+	for (std::size_t i{}; i < count; ++i) {
+		out[i] = values[i].microseconds();
+	}
+}
+
+void add(time *values, const std::size_t count, const time offset) noexcept {
+#if defined(GXZN_CHRONO_BULK_AVX2)
+	if (avx2_supported()) [[likely]] {
+		add_avx2(values, count, offset.microseconds());
+		return;
+	}
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+	add_scalar(values, count, offset.microseconds());
+}
+
+void subtract(time *values, const std::size_t count, const time offset) noexcept {
+	add(values, count, -offset);
+}
+
+void clamp(time *values, const std::size_t count, const time low, const time high) noexcept {
+#if defined(GXZN_CHRONO_BULK_AVX2)
+	if (avx2_supported()) [[likely]] {
+		clamp_avx2(values, count, low.microseconds(), high.microseconds());
+		return;
+	}
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+	clamp_scalar(values, count, low.microseconds(), high.microseconds());
+}
+
+time min(const time *values, const std::size_t count) noexcept {
+	if (count == 0) [[unlikely]] return time::zero();
+
+	static constexpr auto init{ std::numeric_limits<i64>::max() };
+#if defined(GXZN_CHRONO_BULK_AVX2)
+	if (avx2_supported()) [[likely]] {
+		return time{ extremum_avx2<true>(values, count, init) };
+	}
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+	return time{ min_scalar(values, count, init) };
+}
+
+time max(const time *values, const std::size_t count) noexcept {
+	if (count == 0) [[unlikely]] return time::zero();
+
+	static constexpr auto init{ std::numeric_limits<i64>::min() };
+#if defined(GXZN_CHRONO_BULK_AVX2)
+	if (avx2_supported()) [[likely]] {
+		return time{ extremum_avx2<false>(values, count, init) };
+	}
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+	return time{ max_scalar(values, count, init) };
+}
+
+time sum(const time *values, const std::size_t count) noexcept {
+#if defined(GXZN_CHRONO_BULK_AVX2)
+	if (avx2_supported()) [[likely]] {
+		return time{ sum_avx2(values, count) };
+	}
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+	return time{ sum_scalar(values, count, 0) };
+}
+
+bool accelerated() noexcept {
+#if defined(GXZN_CHRONO_BULK_AVX2)
+	return avx2_supported();
+#else
+	return false;
+#endif // defined(GXZN_CHRONO_BULK_AVX2)
+}
+
+} // namespace golxzn::os::chrono::bulk
@@ -0,0 +1,90 @@
+#include <cmath>
+#include <algorithm>
+
+#include "golxzn/os/chrono/lateness.hpp"
+
+namespace golxzn::os::chrono {
+
+void lateness_histogram::record(const time value) noexcept {
+	const auto microseconds{ static_cast<u64>(std::max(value.microseconds(), i64{})) };
+
+	m_buckets[bucket_of(microseconds)].fetch_add(1, std::memory_order_relaxed);
+	m_sum.fetch_add(microseconds, std::memory_order_relaxed);
+	m_count.fetch_add(1, std::memory_order_relaxed);
+
+	auto current{ m_max.load(std::memory_order_relaxed) };
+	while (microseconds > current
+		&& !m_max.compare_exchange_weak(current, microseconds, std::memory_order_relaxed)) {}
+}
+
+u64 lateness_histogram::count() const noexcept {
+	return m_count.load(std::memory_order_relaxed);
+}
+
+time lateness_histogram::percentile(const f64 quantile) const noexcept {
+	u64 total{};
+	for (const auto &bucket : m_buckets) {
+		total += bucket.load(std::memory_order_relaxed);
+	}
+	if (total == 0) return time::zero();
+
+	const auto clamped{ std::clamp(quantile, 0.0, 1.0) };
+	const auto target{ std::max(static_cast<u64>(std::ceil(clamped * static_cast<f64>(total))), u64{ 1 }) };
+
+	u64 accumulated{};
+	for (std::size_t bucket{}; bucket < buckets_count; ++bucket) {
+		accumulated += m_buckets[bucket].load(std::memory_order_relaxed);
+		if (accumulated >= target) {
+			/// The bucket bound could exceed the real maximum, so the exact one is preferred
+			return time{ static_cast<i64>(std::min(bucket_upper_bound(bucket), m_max.load(std::memory_order_relaxed))) };
+		}
+	}
+	return max();
+}
+
+time lateness_histogram::max() const noexcept {
+	return time{ static_cast<i64>(m_max.load(std::memory_order_relaxed)) };
+}
+
+time lateness_histogram::mean() const noexcept {
+	const auto values{ count() };
+	if (values == 0) return time::zero();
+	return time{ static_cast<i64>(m_sum.load(std::memory_order_relaxed) / values) };
+}
+
+time lateness_histogram::sum() const noexcept {
+	return time{ static_cast<i64>(m_sum.load(std::memory_order_relaxed)) };
+}
+
+u64 lateness_histogram::bucket_count(const std::size_t bucket) const noexcept {
+	return bucket < buckets_count ? m_buckets[bucket].load(std::memory_order_relaxed) : 0;
+}
+
+void lateness_histogram::reset() noexcept {
+	for (auto &bucket : m_buckets) {
+		bucket.store(0, std::memory_order_relaxed);
+	}
+	m_count.store(0, std::memory_order_relaxed);
+	m_sum.store(0, std::memory_order_relaxed);
+	m_max.store(0, std::memory_order_relaxed);
+}
+
+namespace lateness {
+
+namespace {
+
+std::atomic<lateness_histogram *> current_sink{};
+
+} // anonymous namespace
+
+void set_sink(lateness_histogram *histogram) noexcept {
+	current_sink.store(histogram, std::memory_order_release);
+}
+
+lateness_histogram *sink() noexcept {
+	return current_sink.load(std::memory_order_acquire);
+}
+
+} // namespace lateness
+
+} // namespace golxzn::os::chrono
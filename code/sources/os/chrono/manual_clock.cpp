@@ -0,0 +1,72 @@
+#include "golxzn/os/chrono/manual_clock.hpp"
+
+namespace golxzn::os::chrono {
+
+manual_clock::manual_clock(const time_point start) noexcept
+	: m_now{ start } {}
+
+manual_clock::time_point manual_clock::now() const noexcept {
+	return m_now.load(std::memory_order_acquire);
+}
+
+std::size_t manual_clock::advance(const time step) {
+	if (step < time::zero()) [[unlikely]] {
+		return advance_to(now());
+	}
+	return advance_to(now() + step.duration());
+}
+
+std::size_t manual_clock::advance_to(const time_point point) {
+	std::size_t called{};
+	while (true) {
+		task current;
+		{
+			std::lock_guard lock{ m_tasks_mutex };
+			const auto next{ std::begin(m_tasks) };
+			if (next == std::end(m_tasks) || next->first.first > point) {
+				if (point > m_now.load(std::memory_order_relaxed)) {
+					m_now.store(point, std::memory_order_release);
+				}
+				break;
+			}
+
+			const auto [deadline, id]{ next->first };
+			if (deadline > m_now.load(std::memory_order_relaxed)) {
+				m_now.store(deadline, std::memory_order_release);
+			}
+			current = std::move(next->second);
+			m_tasks.erase(next);
+			m_deadlines.erase(id);
+		}
+
+		/// Called without lock, so task is able to schedule, cancel and even advance.
+		current();
+		++called;
+	}
+	return called;
+}
+
+manual_clock::task_id manual_clock::schedule(const time_point deadline, task &&callback) {
+	std::lock_guard lock{ m_tasks_mutex };
+	const auto id{ ++m_last_id };
+	m_tasks.emplace(task_key{ deadline, id }, std::move(callback));
+	m_deadlines.emplace(id, deadline);
+	return id;
+}
+
+bool manual_clock::cancel(const task_id id) {
+	std::lock_guard lock{ m_tasks_mutex };
+	const auto found{ m_deadlines.find(id) };
+	if (found == std::end(m_deadlines)) return false;
+
+	m_tasks.erase(task_key{ found->second, id });
+	m_deadlines.erase(found);
+	return true;
+}
+
+std::size_t manual_clock::pending() const {
+	std::lock_guard lock{ m_tasks_mutex };
+	return m_tasks.size();
+}
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <cstdio>
+#include <charconv>
+#include <fstream>
+
+#include "golxzn/os/chrono/openmetrics.hpp"
+
+#if defined(GOLXZN_MULTITHREADING)
+#if defined(GXZN_CHRONO_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <unistd.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#endif // defined(GXZN_CHRONO_WINDOWS)
+#endif // defined(GOLXZN_MULTITHREADING)
+
+namespace golxzn::os::chrono::openmetrics {
+
+void writer::histogram(std::string_view name, const lateness_histogram &values, std::string_view help) {
+	family(name, {}, "histogram", help);
+
+	/// Buckets are merged by powers of two, so bounds are 2^k - 1 microseconds
+	u64 cumulative{};
+	constexpr auto groups{ lateness_histogram::buckets_count / lateness_histogram::sub_buckets };
+	for (std::size_t group{}; group < groups; ++group) {
+		const auto first{ group * lateness_histogram::sub_buckets };
+		for (std::size_t bucket{ first }; bucket < first + lateness_histogram::sub_buckets; ++bucket) {
+			cumulative += values.bucket_count(bucket);
+		}
+
+		m_buffer.append(name).append("_bucket{le=\"");
+		const auto bound{ lateness_histogram::bucket_upper_bound(first + lateness_histogram::sub_buckets - 1) };
+		append_seconds(static_cast<i64>(bound));
+		m_buffer.pop_back(); // the line end
+		m_buffer.append("\"} ");
+		append(cumulative);
+	}
+
+	sample(name, "_bucket", "{le=\"+Inf\"}");
+	append(cumulative);
+	sample(name, "_count");
+	append(cumulative);
+	sample(name, "_sum");
+	append_seconds(values.sum().microseconds());
+}
+
+void writer::gauge(std::string_view name, const time value, std::string_view help) {
+	family(name, {}, "gauge", help);
+	sample(name, {});
+	append_seconds(value.microseconds());
+}
+
+void writer::gauge(std::string_view name, const f64 value, std::string_view help) {
+	family(name, {}, "gauge", help);
+	sample(name, {});
+	append(value);
+}
+
+void writer::counter(std::string_view name, const u64 value, std::string_view help) {
+	family(name, {}, "counter", help);
+	sample(name, "_total");
+	append(value);
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+void writer::counters(std::string_view name, const timer_service_stats &stats) {
+	struct entry {
+		std::string_view suffix;
+		u64 value;
+		std::string_view help;
+	};
+	const entry entries[]{
+		{ "_armed", stats.armed, "Armed timers" },
+		{ "_fired", stats.fired, "Fired timers" },
+		{ "_cancelled", stats.cancelled, "Cancelled timers" },
+		{ "_rejected", stats.rejected, "Timers rejected because all slots were busy" },
+		{ "_batches", stats.batches, "Drained batches of arm requests" },
+	};
+	for (const auto &[suffix, value, help] : entries) {
+		family(name, suffix, "counter", help);
+		m_buffer.append(name).append(suffix).append("_total ");
+		append(value);
+	}
+
+	family(name, "_largest_batch", "gauge", "The largest drained batch of arm requests");
+	sample(name, "_largest_batch");
+	append(static_cast<f64>(stats.largest_batch));
+}
+#endif // defined(GOLXZN_MULTITHREADING)
+
+void writer::finish() {
+	m_buffer.append("# EOF\n");
+}
+
+void writer::clear() noexcept {
+	m_buffer.clear();
+}
+
+std::string_view writer::text() const noexcept {
+	return m_buffer;
+}
+
+bool writer::write_file(const std::string &path) const {
+	const auto temporary{ path + ".tmp" };
+	{
+		std::ofstream file{ temporary, std::ios::out | std::ios::trunc | std::ios::binary };
+		if (!file) return false;
+		file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+		if (!file) return false;
+	}
+#if defined(GXZN_CHRONO_WINDOWS)
+	std::remove(path.c_str()); // rename doesn't replace files on Windows
+#endif // defined(GXZN_CHRONO_WINDOWS)
+	return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+void writer::family(std::string_view name, std::string_view suffix, std::string_view type, std::string_view help) {
+	m_buffer.append("# TYPE ").append(name).append(suffix).push_back(' ');
+	m_buffer.append(type).push_back('\n');
+	if (help.empty()) return;
+
+	m_buffer.append("# HELP ").append(name).append(suffix).push_back(' ');
+	for (const auto symbol : help) {
+		switch (symbol) {
+			case '\\': m_buffer.append("\\\\"); break;
+			case '\n': m_buffer.append("\\n"); break;
+			case '"': m_buffer.append("\\\""); break;
+			default: m_buffer.push_back(symbol); break;
+		}
+	}
+	m_buffer.push_back('\n');
+}
+
+void writer::sample(std::string_view name, std::string_view suffix, std::string_view labels) {
+	m_buffer.append(name).append(suffix).append(labels).push_back(' ');
+}
+
+void writer::append(const u64 value) {
+	char buffer[24];
+	const auto [end, error]{ std::to_chars(std::begin(buffer), std::end(buffer), value) };
+	m_buffer.append(buffer, end).push_back('\n');
+}
+
+void writer::append(const f64 value) {
+	/// snprintf instead of floating point std::to_chars which isn't available on every platform
+	char buffer[32];
+	const auto length{ std::snprintf(buffer, sizeof(buffer), "%.17g", value) };
+	m_buffer.append(buffer, static_cast<std::size_t>(std::max(length, 0))).push_back('\n');
+}
+
+void writer::append_seconds(const i64 microseconds) {
+	constexpr u64 per_second{ 1'000'000 };
+	if (microseconds < 0) m_buffer.push_back('-');
+	const auto magnitude{ microseconds < 0 ? u64{} - static_cast<u64>(microseconds) : static_cast<u64>(microseconds) };
+
+	char buffer[24];
+	auto [end, error]{ std::to_chars(std::begin(buffer), std::end(buffer), magnitude / per_second) };
+	m_buffer.append(buffer, end).push_back('.');
+
+	auto fraction{ magnitude % per_second };
+	char digits[6];
+	for (auto digit{ std::rbegin(digits) }; digit != std::rend(digits); ++digit) {
+		*digit = static_cast<char>('0' + fraction % 10);
+		fraction /= 10;
+	}
+	m_buffer.append(std::begin(digits), std::end(digits)).push_back('\n');
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+
+namespace {
+
+#if defined(GXZN_CHRONO_WINDOWS)
+using native_socket = SOCKET;
+constexpr std::intptr_t no_socket{ static_cast<std::intptr_t>(INVALID_SOCKET) };
+void close_socket(const native_socket socket) noexcept { closesocket(socket); }
+#else
+using native_socket = int;
+constexpr std::intptr_t no_socket{ -1 };
+void close_socket(const native_socket socket) noexcept { close(socket); }
+#endif // defined(GXZN_CHRONO_WINDOWS)
+
+#if defined(MSG_NOSIGNAL)
+constexpr int send_flags{ MSG_NOSIGNAL };
+#else
+constexpr int send_flags{};
+#endif // defined(MSG_NOSIGNAL)
+
+bool send_all(const native_socket socket, std::string_view data) noexcept {
+	while (!data.empty()) {
+		const auto sent{ send(socket, data.data(), static_cast<int>(data.size()), send_flags) };
+		if (sent <= 0) return false;
+		data.remove_prefix(static_cast<std::size_t>(sent));
+	}
+	return true;
+}
+
+/// A client which connects and sends nothing mustn't stall the server thread, and stop() with it, forever
+void limit_client_time(const native_socket client) noexcept {
+#if defined(GXZN_CHRONO_WINDOWS)
+	const DWORD timeout{ 1000 };
+#else
+	const timeval timeout{ 1, 0 };
+#endif // defined(GXZN_CHRONO_WINDOWS)
+	setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char *>(&timeout), sizeof(timeout));
+	setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char *>(&timeout), sizeof(timeout));
+}
+
+} // anonymous namespace
+
+server::server(const u16 port, collector &&collect)
+	: m_port{ port }, m_collect{ std::move(collect) } {}
+
+server::~server() {
+	stop();
+}
+
+bool server::start() {
+	std::lock_guard lock{ m_mutex };
+	if (m_running.load(std::memory_order_relaxed)) return true;
+
+#if defined(GXZN_CHRONO_WINDOWS)
+	WSADATA data{};
+	if (WSAStartup(MAKEWORD(2, 2), &data) != 0) return false;
+#endif // defined(GXZN_CHRONO_WINDOWS)
+
+	const auto listener{ socket(AF_INET, SOCK_STREAM, IPPROTO_TCP) };
+	if (static_cast<std::intptr_t>(listener) == no_socket) return false;
+
+	const int reuse{ 1 };
+	setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&reuse), sizeof(reuse));
+#if defined(SO_NOSIGPIPE)
+	setsockopt(listener, SOL_SOCKET, SO_NOSIGPIPE, &reuse, sizeof(reuse));
+#endif // defined(SO_NOSIGPIPE)
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(m_port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	socklen_t length{ sizeof(address) };
+	if (bind(listener, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0
+		|| listen(listener, 8) != 0
+		|| getsockname(listener, reinterpret_cast<sockaddr *>(&address), &length) != 0) {
+		close_socket(listener);
+		return false;
+	}
+
+	m_port = ntohs(address.sin_port);
+	m_socket = static_cast<std::intptr_t>(listener);
+	m_running.store(true, std::memory_order_release);
+	m_thread = std::thread{ [this] { serve(); } };
+	return true;
+}
+
+void server::stop() {
+	std::lock_guard lock{ m_mutex };
+	if (!m_running.exchange(false, std::memory_order_acq_rel)) return;
+
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+	close_socket(static_cast<native_socket>(m_socket));
+	m_socket = no_socket;
+#if defined(GXZN_CHRONO_WINDOWS)
+	WSACleanup();
+#endif // defined(GXZN_CHRONO_WINDOWS)
+}
+
+u16 server::port() const noexcept {
+	return m_port;
+}
+
+void server::serve() {
+	const auto listener{ static_cast<native_socket>(m_socket) };
+	writer metrics;
+	std::string response;
+	char request[4096];
+
+	while (m_running.load(std::memory_order_acquire)) {
+		/// select with timeout, so stop() is noticed without closing the socket under accept
+		fd_set readable;
+		FD_ZERO(&readable);
+		FD_SET(listener, &readable);
+		timeval timeout{ 0, 100'000 };
+		if (select(static_cast<int>(listener) + 1, &readable, nullptr, nullptr, &timeout) <= 0) continue;
+
+		const auto client{ accept(listener, nullptr, nullptr) };
+		if (static_cast<std::intptr_t>(client) == no_socket) continue;
+
+		limit_client_time(client);
+
+		/// The request isn't parsed: every path answers with metrics
+		recv(client, request, static_cast<int>(sizeof(request)), 0);
+
+		metrics.clear();
+		m_collect(metrics);
+		metrics.finish();
+
+		response.clear();
+		response.append("HTTP/1.0 200 OK\r\nContent-Type: ").append(writer::content_type);
+		response.append("\r\nContent-Length: ").append(std::to_string(metrics.text().size()));
+		response.append("\r\nConnection: close\r\n\r\n").append(metrics.text());
+		send_all(client, response);
+		close_socket(client);
+	}
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono::openmetrics
@@ -0,0 +1,185 @@
+#include "golxzn/os/chrono/perf.hpp"
+
+#if defined(GXZN_CHRONO_LINUX)
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif // defined(GXZN_CHRONO_LINUX)
+
+namespace golxzn::os::chrono {
+
+namespace perf {
+
+#if defined(GXZN_CHRONO_LINUX)
+
+namespace {
+
+constexpr std::array<u64, 4> events{
+	PERF_COUNT_HW_CPU_CYCLES,
+	PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_CACHE_MISSES,
+	PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+u64 counters::*const fields[]{
+	&counters::cycles,
+	&counters::instructions,
+	&counters::cache_misses,
+	&counters::branch_misses,
+};
+
+/// Per thread group of counters. The first opened counter is the group leader.
+class thread_counters {
+public:
+	thread_counters() noexcept {
+		for (std::size_t i{}; i < std::size(events); ++i) {
+			perf_event_attr attributes{};
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.size = sizeof(attributes);
+			attributes.config = events[i];
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			attributes.read_format = PERF_FORMAT_GROUP;
+
+			const auto leader{ m_count == 0 ? -1 : m_descriptors[0] };
+			const auto descriptor{ static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, leader, 0)) };
+			if (descriptor < 0) continue;
+
+			m_descriptors[m_count] = descriptor;
+			m_fields[m_count] = fields[i];
+			m_pages[m_count] = map_page(descriptor);
+			++m_count;
+		}
+
+		m_user_space = m_count != 0;
+		for (std::size_t i{}; i < m_count; ++i) {
+			m_user_space = m_user_space && m_pages[i] != nullptr && m_pages[i]->cap_user_rdpmc;
+		}
+	}
+
+	~thread_counters() {
+		for (std::size_t i{}; i < m_count; ++i) {
+			if (m_pages[i] != nullptr) {
+				munmap(m_pages[i], page_size());
+			}
+			close(m_descriptors[i]);
+		}
+	}
+
+	thread_counters(const thread_counters &) = delete;
+	thread_counters &operator=(const thread_counters &) = delete;
+
+	[[nodiscard]] bool valid() const noexcept { return m_count != 0; }
+	[[nodiscard]] bool user_space() const noexcept { return m_user_space; }
+
+	bool read(counters &out) const noexcept {
+		if (!valid()) return false;
+
+		if (m_user_space) {
+			bool success{ true };
+			for (std::size_t i{}; i < m_count && success; ++i) {
+				success = read_user_space(*m_pages[i], out.*m_fields[i]);
+			}
+			if (success) return true;
+		}
+
+		/// PERF_FORMAT_GROUP layout: { nr, values[nr] }
+		std::array<u64, 1 + std::size(events)> buffer{};
+		const auto expected{ static_cast<ssize_t>(sizeof(u64) * (1 + m_count)) };
+		if (::read(m_descriptors[0], buffer.data(), sizeof(buffer)) < expected) return false;
+
+		for (std::size_t i{}; i < m_count; ++i) {
+			out.*m_fields[i] = buffer[1 + i];
+		}
+		return true;
+	}
+
+private:
+	std::array<int, std::size(events)> m_descriptors{};
+	std::array<u64 counters::*, std::size(events)> m_fields{};
+	std::array<perf_event_mmap_page *, std::size(events)> m_pages{};
+	std::size_t m_count{};
+	bool m_user_space{};
+
+	[[nodiscard]] static std::size_t page_size() noexcept {
+		static const auto size{ static_cast<std::size_t>(sysconf(_SC_PAGESIZE)) };
+		return size;
+	}
+
+	[[nodiscard]] static perf_event_mmap_page *map_page(const int descriptor) noexcept {
+		void *page{ mmap(nullptr, page_size(), PROT_READ, MAP_SHARED, descriptor, 0) };
+		return page == MAP_FAILED ? nullptr : static_cast<perf_event_mmap_page *>(page);
+	}
+
+	/// Self-monitoring read protocol described in linux/perf_event.h
+	[[nodiscard]] static bool read_user_space(const perf_event_mmap_page &page, u64 &value) noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+		const volatile auto &shared{ page };
+		u32 sequence{};
+		i64 count{};
+		do {
+			sequence = shared.lock;
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+
+			const u32 index{ shared.index };
+			if (!shared.cap_user_rdpmc || index == 0) return false;
+
+			count = shared.offset;
+			u32 low{}, high{};
+			asm volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(index - 1));
+			const auto shift{ 64 - shared.pmc_width };
+			count += static_cast<i64>((static_cast<u64>(high) << 32 | low) << shift) >> shift;
+
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+		} while (shared.lock != sequence);
+
+		value = static_cast<u64>(count);
+		return true;
+#else
+		static_cast<void>(page);
+		static_cast<void>(value);
+		return false;
+#endif
+	}
+};
+
+const thread_counters &local() noexcept {
+	thread_local const thread_counters instance;
+	return instance;
+}
+
+} // anonymous namespace
+
+bool available() noexcept {
+	return local().valid();
+}
+
+bool user_space_reads() noexcept {
+	return local().user_space();
+}
+
+bool read(counters &out) noexcept {
+	return local().read(out);
+}
+
+#else // ^^^ defined(GXZN_CHRONO_LINUX) ^^^ / vvv !defined(GXZN_CHRONO_LINUX) vvv
+
+bool available() noexcept { return false; }
+bool user_space_reads() noexcept { return false; }
+bool read(counters &) noexcept { return false; }
+
+#endif // defined(GXZN_CHRONO_LINUX)
+
+} // namespace perf
+
+f64 perf_sample::ipc() const noexcept {
+	if (!counters_valid || counters.cycles == 0) return 0.0;
+	return static_cast<f64>(counters.instructions) / static_cast<f64>(counters.cycles);
+}
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,246 @@
+#include <map>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+
+#include "golxzn/os/chrono/profiler.hpp"
+
+namespace golxzn::os::chrono::profiler {
+
+namespace {
+
+constexpr u32 no_node{ ~u32{} };
+constexpr u32 root_node{};
+
+struct node {
+	site_id site{};
+	u32 parent{};
+	u32 first_child{ no_node };  ///< Owner thread only
+	u32 next_sibling{ no_node }; ///< Owner thread only
+
+	/// Written only by the owner thread, so plain load and store are enough
+	std::atomic<u64> calls{};
+	std::atomic<u64> inclusive{};
+	std::atomic<u64> exclusive{};
+	std::atomic<u64> max{};
+};
+
+struct frame {
+	u32 node{};
+	i64 children{};
+};
+
+class thread_tree {
+public:
+	explicit thread_tree(const std::size_t capacity)
+		: m_capacity{ static_cast<u32>(std::clamp<std::size_t>(capacity, 1, no_node - 1)) }
+		, m_nodes{ std::make_unique<node[]>(m_capacity) } {
+		m_stack.reserve(64);
+	}
+
+	[[nodiscard]] u32 enter(const site_id site) {
+		const auto parent{ m_stack.empty() ? root_node : m_stack.back().node };
+		if (parent == no_node) [[unlikely]] return drop();
+
+		auto child{ m_nodes[parent].first_child };
+		while (child != no_node && m_nodes[child].site != site) {
+			child = m_nodes[child].next_sibling;
+		}
+
+		if (child == no_node) {
+			const auto size{ m_size.load(std::memory_order_relaxed) };
+			if (size == m_capacity) [[unlikely]] return drop();
+
+			child = size;
+			auto &created{ m_nodes[child] };
+			created.site = site;
+			created.parent = parent;
+			created.next_sibling = m_nodes[parent].first_child;
+			m_nodes[parent].first_child = child;
+			m_size.store(size + 1, std::memory_order_release);
+		}
+
+		m_stack.push_back(frame{ child, 0 });
+		return child;
+	}
+
+	void leave(const u32 index, const time elapsed) noexcept {
+		const auto inclusive{ std::max(elapsed.microseconds(), i64{}) };
+		const auto children{ m_stack.back().children };
+		m_stack.pop_back();
+		if (!m_stack.empty()) {
+			m_stack.back().children += inclusive;
+		}
+		if (index == no_node) [[unlikely]] return;
+
+		auto &target{ m_nodes[index] };
+		add(target.calls, 1);
+		add(target.inclusive, static_cast<u64>(inclusive));
+		add(target.exclusive, static_cast<u64>(std::max(inclusive - children, i64{})));
+		if (static_cast<u64>(inclusive) > target.max.load(std::memory_order_relaxed)) {
+			target.max.store(static_cast<u64>(inclusive), std::memory_order_relaxed);
+		}
+	}
+
+	[[nodiscard]] u64 dropped() const noexcept {
+		return m_dropped.load(std::memory_order_relaxed);
+	}
+
+	template<class Visitor>
+	void visit(Visitor &&visitor) const {
+		const auto size{ m_size.load(std::memory_order_acquire) };
+		for (u32 index{ root_node + 1 }; index < size; ++index) {
+			visitor(index, m_nodes[index]);
+		}
+	}
+
+private:
+	const u32 m_capacity;
+	std::unique_ptr<node[]> m_nodes;
+	std::atomic<u32> m_size{ root_node + 1 };
+	std::vector<frame> m_stack;
+	std::atomic<u64> m_dropped{};
+
+	/// The placeholder frame keeps nested scopes off the wrong parent and their time off its exclusive time
+	[[nodiscard]] u32 drop() {
+		m_stack.push_back(frame{ no_node, 0 });
+		add(m_dropped, 1);
+		return no_node;
+	}
+
+	static void add(std::atomic<u64> &target, const u64 value) noexcept {
+		target.store(target.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+};
+
+struct registry {
+	std::mutex mutex;
+	std::vector<std::shared_ptr<const thread_tree>> trees;
+	std::deque<std::string> names;
+	std::unordered_map<std::string_view, site_id> ids;
+	std::atomic<std::size_t> capacity{ 4096 };
+};
+
+registry &global() {
+	static registry instance;
+	return instance;
+}
+
+thread_tree &local_tree() {
+	thread_local const std::shared_ptr<thread_tree> tree{ [] {
+		auto &shared{ global() };
+		auto created{ std::make_shared<thread_tree>(shared.capacity.load(std::memory_order_relaxed)) };
+		std::lock_guard lock{ shared.mutex };
+		shared.trees.push_back(created);
+		return created;
+	}() };
+	return *tree;
+}
+
+} // anonymous namespace
+
+site::site(const std::string_view name) {
+	auto &shared{ global() };
+	std::lock_guard lock{ shared.mutex };
+	if (const auto found{ shared.ids.find(name) }; found != std::end(shared.ids)) {
+		m_id = found->second;
+		return;
+	}
+
+	m_id = static_cast<site_id>(shared.names.size());
+	const auto &stored{ shared.names.emplace_back(name) };
+	shared.ids.emplace(stored, m_id);
+}
+
+site_id site::id() const noexcept {
+	return m_id;
+}
+
+scope::scope(const site &where)
+	: m_node{ local_tree().enter(where.id()) } {}
+
+scope::~scope() {
+	local_tree().leave(m_node, m_clock.elapsed());
+}
+
+std::string profile::folded() const {
+	std::vector<std::string> names;
+	{
+		auto &shared{ global() };
+		std::lock_guard lock{ shared.mutex };
+		names.assign(std::begin(shared.names), std::end(shared.names));
+	}
+
+	std::string result;
+	for (const auto &path : paths) {
+		for (std::size_t depth{}; depth < path.sites.size(); ++depth) {
+			if (depth != 0) result.push_back(';');
+			result.append(path.sites[depth] < names.size() ? names[path.sites[depth]] : std::string{ "?" });
+		}
+		result.push_back(' ');
+		result.append(std::to_string(path.exclusive.microseconds()));
+		result.push_back('\n');
+	}
+	return result;
+}
+
+bool profile::write_folded(const std::string &path) const {
+	std::ofstream file{ path, std::ios::out | std::ios::trunc };
+	if (!file) return false;
+
+	file << folded();
+	return static_cast<bool>(file);
+}
+
+void set_arena_capacity(const std::size_t nodes) noexcept {
+	global().capacity.store(nodes, std::memory_order_relaxed);
+}
+
+std::string site_name(const site_id id) {
+	auto &shared{ global() };
+	std::lock_guard lock{ shared.mutex };
+	return id < shared.names.size() ? shared.names[id] : std::string{};
+}
+
+profile snapshot() {
+	std::vector<std::shared_ptr<const thread_tree>> trees;
+	{
+		auto &shared{ global() };
+		std::lock_guard lock{ shared.mutex };
+		trees = shared.trees;
+	}
+
+	std::map<std::vector<site_id>, call_path> merged;
+	std::vector<std::vector<site_id>> node_paths;
+	profile result;
+	for (const auto &tree : trees) {
+		result.dropped += tree->dropped();
+		node_paths.assign(1, {});
+		tree->visit([&merged, &node_paths](const u32 index, const node &current) {
+			/// Parents are always created before children, so their paths are known
+			auto sites{ node_paths[current.parent] };
+			sites.push_back(current.site);
+			node_paths.resize(index + 1);
+			node_paths[index] = sites;
+
+			auto &path{ merged[std::move(sites)] };
+			path.calls += current.calls.load(std::memory_order_relaxed);
+			path.inclusive = path.inclusive + time{ static_cast<i64>(current.inclusive.load(std::memory_order_relaxed)) };
+			path.exclusive = path.exclusive + time{ static_cast<i64>(current.exclusive.load(std::memory_order_relaxed)) };
+			path.max = std::max(path.max, time{ static_cast<i64>(current.max.load(std::memory_order_relaxed)) });
+		});
+	}
+
+	result.paths.reserve(merged.size());
+	for (auto &[sites, path] : merged) {
+		path.sites = sites;
+		result.paths.push_back(std::move(path));
+	}
+	return result;
+}
+
+} // namespace golxzn::os::chrono::profiler
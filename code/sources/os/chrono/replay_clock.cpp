@@ -0,0 +1,257 @@
+#include <atomic>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "golxzn/os/chrono/replay_clock.hpp"
+
+namespace golxzn::os::chrono {
+
+namespace {
+
+constexpr char file_magic[8]{ 'G', 'X', 'C', 'L', 'O', 'C', 'K', '\1' };
+constexpr std::size_t max_varint_bytes{ 10 };
+
+u64 next_id() noexcept {
+	static std::atomic<u64> last{};
+	return last.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+/// Deltas of monotonic reads are small and positive, so zigzag varints keep them in a few bytes
+std::size_t encode(u8 *target, const i64 delta) noexcept {
+	auto value{ (static_cast<u64>(delta) << 1) ^ static_cast<u64>(delta >> 63) };
+	std::size_t length{};
+	while (value >= 0x80) {
+		target[length++] = static_cast<u8>(value | 0x80);
+		value >>= 7;
+	}
+	target[length++] = static_cast<u8>(value);
+	return length;
+}
+
+bool decode(const u8 *&position, const u8 *end, i64 &last) noexcept {
+	u64 value{};
+	for (u32 shift{}; position != end && shift < 64; shift += 7) {
+		const auto byte{ *position++ };
+		value |= static_cast<u64>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			const auto delta{ static_cast<i64>(value >> 1) ^ -static_cast<i64>(value & 1) };
+			last = static_cast<i64>(static_cast<u64>(last) + static_cast<u64>(delta));
+			return true;
+		}
+	}
+	return false;
+}
+
+void write_u64(std::ofstream &file, const u64 value) {
+	char bytes[sizeof(u64)];
+	for (std::size_t i{}; i < sizeof(u64); ++i) {
+		bytes[i] = static_cast<char>(value >> (i * 8));
+	}
+	file.write(bytes, sizeof(bytes));
+}
+
+bool read_u64(const u8 *&position, const u8 *end, u64 &value) noexcept {
+	if (static_cast<std::size_t>(end - position) < sizeof(u64)) return false;
+	value = 0;
+	for (std::size_t i{}; i < sizeof(u64); ++i) {
+		value |= static_cast<u64>(*position++) << (i * 8);
+	}
+	return true;
+}
+
+} // anonymous namespace
+
+struct clock_recording::stream {
+	std::unique_ptr<u8[]> bytes;
+	std::size_t capacity{};
+	std::size_t size{};
+	i64 last{};
+	bool truncated{};
+};
+
+clock_recording::clock_recording(const std::size_t stream_capacity)
+	: m_id{ next_id() }, m_capacity{ std::max(stream_capacity, max_varint_bytes) } {}
+
+clock_recording::~clock_recording() = default;
+
+void clock_recording::append(const i64 nanoseconds) noexcept {
+	thread_local u64 owner{};
+	thread_local stream *target{};
+	if (owner != m_id) [[unlikely]] {
+		target = &thread_stream();
+		owner = m_id;
+	}
+
+	if (target->truncated) [[unlikely]] return;
+	if (target->capacity - target->size < max_varint_bytes) [[unlikely]] {
+		target->truncated = true;
+		return;
+	}
+	target->size += encode(target->bytes.get() + target->size, nanoseconds - target->last);
+	target->last = nanoseconds;
+}
+
+std::size_t clock_recording::streams() const {
+	std::lock_guard lock{ m_mutex };
+	return std::size(m_streams);
+}
+
+std::vector<i64> clock_recording::values(const std::size_t index) const {
+	std::vector<i64> result;
+	const auto source{ find(index) };
+	if (source == nullptr) return result;
+
+	const u8 *position{ source->bytes.get() };
+	const u8 *end{ position + source->size };
+	for (i64 value{}; decode(position, end, value);) {
+		result.push_back(value);
+	}
+	return result;
+}
+
+bool clock_recording::truncated(const std::size_t index) const {
+	const auto source{ find(index) };
+	return source != nullptr && source->truncated;
+}
+
+std::size_t clock_recording::bytes() const {
+	std::lock_guard lock{ m_mutex };
+	std::size_t total{};
+	for (const auto &source : m_streams) {
+		total += source->size;
+	}
+	return total;
+}
+
+bool clock_recording::save(const std::string &path) const {
+	std::lock_guard lock{ m_mutex };
+	std::ofstream file{ path, std::ios::out | std::ios::trunc | std::ios::binary };
+	if (!file) return false;
+
+	file.write(file_magic, sizeof(file_magic));
+	write_u64(file, std::size(m_streams));
+	for (const auto &source : m_streams) {
+		write_u64(file, source->size);
+		file.put(static_cast<char>(source->truncated));
+		file.write(reinterpret_cast<const char *>(source->bytes.get()), static_cast<std::streamsize>(source->size));
+	}
+	return static_cast<bool>(file);
+}
+
+bool clock_recording::load(const std::string &path) {
+	std::lock_guard lock{ m_mutex };
+	m_streams.clear();
+	m_owners.clear();
+	m_id = next_id(); // forgets streams cached by recording threads
+
+	std::ifstream file{ path, std::ios::in | std::ios::binary };
+	if (!file) return false;
+	const std::vector<char> content{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+
+	const auto *position{ reinterpret_cast<const u8 *>(content.data()) };
+	const auto *end{ position + std::size(content) };
+	if (std::size(content) < sizeof(file_magic)
+		|| !std::equal(std::begin(file_magic), std::end(file_magic), content.begin())) {
+		return false;
+	}
+	position += sizeof(file_magic);
+
+	u64 count{};
+	if (!read_u64(position, end, count)) return false;
+
+	std::vector<std::unique_ptr<stream>> loaded;
+	for (u64 index{}; index < count; ++index) {
+		u64 size{};
+		if (!read_u64(position, end, size) || static_cast<u64>(end - position) < size + 1) return false;
+
+		auto source{ std::make_unique<stream>() };
+		source->truncated = *position++ != 0;
+		source->size = source->capacity = static_cast<std::size_t>(size);
+		source->bytes = std::make_unique<u8[]>(source->capacity);
+		std::copy(position, position + size, source->bytes.get());
+		position += size;
+		loaded.emplace_back(std::move(source));
+	}
+	if (position != end) return false;
+
+	m_streams = std::move(loaded);
+	return true;
+}
+
+clock_recording::stream &clock_recording::thread_stream() {
+	std::lock_guard lock{ m_mutex };
+	auto &target{ m_owners[std::this_thread::get_id()] };
+	if (target == nullptr) {
+		auto &source{ m_streams.emplace_back(std::make_unique<stream>()) };
+		source->capacity = m_capacity;
+		source->bytes = std::make_unique<u8[]>(m_capacity);
+		target = source.get();
+	}
+	return *target;
+}
+
+const clock_recording::stream *clock_recording::find(const std::size_t index) const {
+	std::lock_guard lock{ m_mutex };
+	return index < std::size(m_streams) ? m_streams[index].get() : nullptr;
+}
+
+
+struct replay_clock::cursor {
+	const clock_recording::stream *source{};
+	std::size_t position{};
+	i64 last{};
+};
+
+replay_clock::replay_clock(const clock_recording &recording)
+	: m_id{ next_id() }, m_recording{ recording } {}
+
+replay_clock::~replay_clock() = default;
+
+replay_clock::time_point replay_clock::now() const noexcept {
+	thread_local u64 owner{};
+	thread_local cursor *target{};
+	if (owner != m_id) [[unlikely]] {
+		target = &thread_cursor();
+		owner = m_id;
+	}
+
+	if (target->source != nullptr && target->position < target->source->size) {
+		const u8 *begin{ target->source->bytes.get() };
+		const u8 *position{ begin + target->position };
+		decode(position, begin + target->source->size, target->last);
+		target->position = static_cast<std::size_t>(position - begin);
+	}
+	return time_point{ duration{ target->last } };
+}
+
+bool replay_clock::bind(const std::size_t stream) {
+	auto &target{ thread_cursor() };
+	std::lock_guard lock{ m_mutex };
+	target.source = m_recording.find(stream);
+	target.position = 0;
+	target.last = 0;
+	return target.source != nullptr;
+}
+
+std::size_t replay_clock::remaining() const {
+	const auto &target{ thread_cursor() };
+	if (target.source == nullptr) return 0;
+
+	/// Every varint ends with a byte without the continuation bit
+	const u8 *bytes{ target.source->bytes.get() };
+	return static_cast<std::size_t>(std::count_if(bytes + target.position, bytes + target.source->size,
+		[](const u8 byte) { return (byte & 0x80) == 0; }));
+}
+
+replay_clock::cursor &replay_clock::thread_cursor() const {
+	std::lock_guard lock{ m_mutex };
+	auto &target{ m_cursors[std::this_thread::get_id()] };
+	if (target == nullptr) {
+		target = std::make_unique<cursor>();
+		target->source = m_recording.find(m_next_stream++);
+	}
+	return *target;
+}
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,390 @@
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <cinttypes>
+#include <unordered_map>
+
+#include "golxzn/os/chrono/sampler.hpp"
+
+#if defined(GXZN_CHRONO_LINUX)
+#include <ctime>
+#include <cerrno>
+#include <thread>
+#include <csignal>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <sys/syscall.h>
+#endif // defined(GXZN_CHRONO_LINUX)
+
+namespace golxzn::os::chrono::profiler {
+
+namespace {
+
+/// Single producer (the signal handler of the owning thread) single consumer (collect) ring of samples
+struct sample_ring {
+	struct record {
+		std::size_t depth{};
+		std::uintptr_t frames[sampler::max_depth]{};
+	};
+
+	std::unique_ptr<record[]> records;
+	std::size_t capacity{};
+	std::atomic<std::size_t> head{};
+	std::atomic<std::size_t> tail{};
+	std::atomic<u64> dropped{};
+	std::uintptr_t stack_low{};
+	std::uintptr_t stack_high{};
+
+	void push(const void *context) noexcept;
+};
+
+std::string hexadecimal(const std::uintptr_t value) {
+	char buffer[2 + sizeof(std::uintptr_t) * 2 + 1];
+	std::snprintf(buffer, sizeof(buffer), "0x%" PRIxPTR, value);
+	return buffer;
+}
+
+#if defined(GXZN_CHRONO_LINUX)
+
+std::size_t walk(const void *context, std::uintptr_t *frames, const std::uintptr_t low, const std::uintptr_t high) noexcept {
+	const auto &machine{ static_cast<const ucontext_t *>(context)->uc_mcontext };
+#if defined(__x86_64__)
+	const auto pc{ static_cast<std::uintptr_t>(machine.gregs[REG_RIP]) };
+	auto fp{ static_cast<std::uintptr_t>(machine.gregs[REG_RBP]) };
+#elif defined(__aarch64__)
+	const auto pc{ static_cast<std::uintptr_t>(machine.pc) };
+	auto fp{ static_cast<std::uintptr_t>(machine.regs[29]) };
+#else
+	(void)machine;
+	const std::uintptr_t pc{};
+	std::uintptr_t fp{};
+#endif // defined(__x86_64__)
+	if (pc == 0) return 0;
+
+	/// Every frame starts with the caller's frame pointer followed by the return address.
+	/// Frames are validated against the thread stack, so garbage in the frame pointer register is harmless.
+	std::size_t depth{};
+	frames[depth++] = pc;
+	while (depth < sampler::max_depth && fp >= low && fp <= high - 2 * sizeof(std::uintptr_t)
+		&& fp % sizeof(std::uintptr_t) == 0) {
+		const auto *frame{ reinterpret_cast<const std::uintptr_t *>(fp) };
+		const auto caller{ frame[0] };
+		const auto return_address{ frame[1] };
+		if (return_address == 0) break;
+
+		frames[depth++] = return_address;
+		if (caller <= fp) break; // stacks grow down, so callers' frames are above
+		fp = caller;
+	}
+	return depth;
+}
+
+void sample_ring::push(const void *context) noexcept {
+	const auto position{ head.load(std::memory_order_relaxed) };
+	if (position - tail.load(std::memory_order_acquire) >= capacity) {
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	auto &target{ records[position % capacity] };
+	target.depth = walk(context, target.frames, stack_low, stack_high);
+	head.store(position + 1, std::memory_order_release);
+}
+
+/// Trivial, so the signal handler could read it without touching thread-local initialization
+struct thread_slot {
+	u64 generation;
+	sample_ring *ring;
+};
+
+struct thread_detacher {
+	sampler *owner{};
+	u64 generation{};
+
+	~thread_detacher();
+};
+
+std::mutex active_mutex;
+sampler *active{};
+u64 last_generation{};
+bool handler_installed{};
+struct sigaction previous_action {};
+
+std::atomic<u64> active_generation{};
+std::atomic<u32> running_handlers{};
+
+thread_local thread_slot slot{};
+thread_local thread_detacher detacher{};
+
+void on_signal(int, siginfo_t *, void *context) noexcept {
+	const auto saved_errno{ errno };
+	/// Pairs with the destructor: either it sees the running handler or the handler sees the reset generation
+	running_handlers.fetch_add(1, std::memory_order_seq_cst);
+	const auto current{ slot };
+	if (current.ring != nullptr && current.generation == active_generation.load(std::memory_order_seq_cst)) {
+		current.ring->push(context);
+	}
+	running_handlers.fetch_sub(1, std::memory_order_release);
+	errno = saved_errno;
+}
+
+thread_detacher::~thread_detacher() {
+	std::lock_guard lock{ active_mutex };
+	if (owner != nullptr && owner == active && generation == active_generation.load(std::memory_order_relaxed)) {
+		owner->detach();
+	}
+}
+
+std::string symbol(const std::uintptr_t address, const bool return_address) {
+	Dl_info info{};
+	/// Return addresses point to the next instruction, which could belong to another function
+	const auto lookup{ return_address ? address - 1 : address };
+	if (dladdr(reinterpret_cast<void *>(lookup), &info) == 0) return hexadecimal(address);
+
+	if (info.dli_sname != nullptr) {
+		int status{};
+		char *demangled{ abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status) };
+		std::string name{ status == 0 && demangled != nullptr ? demangled : info.dli_sname };
+		std::free(demangled);
+		return name;
+	}
+	if (info.dli_fname != nullptr) {
+		std::string_view module{ info.dli_fname };
+		module.remove_prefix(module.find_last_of('/') == std::string_view::npos ? 0 : module.find_last_of('/') + 1);
+		return std::string{ module } + "+" + hexadecimal(address - reinterpret_cast<std::uintptr_t>(info.dli_fbase));
+	}
+	return hexadecimal(address);
+}
+
+#else
+
+std::string symbol(const std::uintptr_t address, const bool) {
+	return hexadecimal(address);
+}
+
+#endif // defined(GXZN_CHRONO_LINUX)
+
+} // anonymous namespace
+
+struct sampler::thread_state {
+	sample_ring ring;
+#if defined(GXZN_CHRONO_LINUX)
+	timer_t timer{};
+#endif // defined(GXZN_CHRONO_LINUX)
+	bool armed{};
+};
+
+std::string sample_profile::folded() const {
+	std::unordered_map<std::uintptr_t, std::string> names;
+	const auto name{ [&names](const std::uintptr_t address, const bool return_address) -> const std::string & {
+		auto found{ names.find(address) };
+		if (found == std::end(names)) {
+			found = names.emplace(address, symbol(address, return_address)).first;
+		}
+		return found->second;
+	} };
+
+	std::string result;
+	for (const auto &stack : stacks) {
+		for (std::size_t index{}; index < stack.frames.size(); ++index) {
+			if (index != 0) result.push_back(';');
+			/// Only the innermost frame is the interrupted instruction itself
+			result.append(name(stack.frames[index], index + 1 != stack.frames.size()));
+		}
+		result.push_back(' ');
+		result.append(std::to_string(stack.samples));
+		result.push_back('\n');
+	}
+	return result;
+}
+
+bool sample_profile::write_folded(const std::string &path) const {
+	std::ofstream file{ path, std::ios::out | std::ios::trunc };
+	if (!file) return false;
+
+	file << folded();
+	return static_cast<bool>(file);
+}
+
+#if defined(GXZN_CHRONO_LINUX)
+
+bool sampler::available() noexcept {
+	return true;
+}
+
+sampler::sampler(const time interval, const std::size_t capacity)
+	: m_interval{ std::max(interval, microseconds(1)) }, m_capacity{ std::max(capacity, std::size_t{ 1 }) } {
+	std::lock_guard lock{ active_mutex };
+	if (active != nullptr) return;
+
+	struct sigaction action {};
+	action.sa_sigaction = &on_signal;
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	if (sigaction(SIGPROF, &action, handler_installed ? nullptr : &previous_action) != 0) return;
+	handler_installed = true;
+
+	active = this;
+	m_generation = ++last_generation;
+	active_generation.store(m_generation, std::memory_order_seq_cst);
+}
+
+sampler::~sampler() {
+	if (!valid()) return;
+
+	std::lock_guard active_lock{ active_mutex };
+	active = nullptr;
+	active_generation.store(0, std::memory_order_seq_cst);
+	while (running_handlers.load(std::memory_order_acquire) != 0) {
+		std::this_thread::yield();
+	}
+
+	{
+		std::lock_guard lock{ m_mutex };
+		for (const auto &state : m_threads) {
+			disarm(*state);
+		}
+	}
+
+	/// Signals of deleted timers could be pending, and the default action of SIGPROF terminates the process
+	struct sigaction fallback {};
+	fallback.sa_handler = SIG_IGN;
+	sigemptyset(&fallback.sa_mask);
+	const auto was_default{ !(previous_action.sa_flags & SA_SIGINFO) && previous_action.sa_handler == SIG_DFL };
+	sigaction(SIGPROF, was_default ? &fallback : &previous_action, nullptr);
+	handler_installed = false;
+}
+
+bool sampler::attach() {
+	if (!valid()) return false;
+	if (slot.ring != nullptr && slot.generation == m_generation) return true;
+
+	auto state{ std::make_shared<thread_state>() };
+	state->ring.records = std::make_unique<sample_ring::record[]>(m_capacity);
+	state->ring.capacity = m_capacity;
+
+	pthread_attr_t attributes;
+	if (pthread_getattr_np(pthread_self(), &attributes) == 0) {
+		void *stack{};
+		std::size_t size{};
+		if (pthread_attr_getstack(&attributes, &stack, &size) == 0) {
+			state->ring.stack_low = reinterpret_cast<std::uintptr_t>(stack);
+			state->ring.stack_high = state->ring.stack_low + size;
+		}
+		pthread_attr_destroy(&attributes);
+	}
+
+	sigevent event{};
+	event.sigev_notify = SIGEV_THREAD_ID;
+	event.sigev_signo = SIGPROF;
+	event._sigev_un._tid = static_cast<pid_t>(syscall(SYS_gettid));
+	if (timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &state->timer) != 0) return false;
+	state->armed = true;
+
+	{
+		std::lock_guard lock{ m_mutex };
+		m_threads.push_back(state);
+	}
+	slot = thread_slot{ m_generation, &state->ring };
+	detacher.owner = this;
+	detacher.generation = m_generation;
+
+	const auto nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::microseconds{ m_interval.microseconds() }).count() };
+	itimerspec spec{};
+	spec.it_interval.tv_sec = static_cast<std::time_t>(nanoseconds / 1'000'000'000);
+	spec.it_interval.tv_nsec = static_cast<long>(nanoseconds % 1'000'000'000);
+	spec.it_value = spec.it_interval;
+	if (timer_settime(state->timer, 0, &spec, nullptr) != 0) {
+		detach();
+		return false;
+	}
+	return true;
+}
+
+void sampler::detach() {
+	if (slot.ring == nullptr || slot.generation != m_generation) return;
+
+	std::lock_guard lock{ m_mutex };
+	for (const auto &state : m_threads) {
+		if (&state->ring == slot.ring) {
+			disarm(*state);
+			break;
+		}
+	}
+	slot = thread_slot{};
+	detacher.owner = nullptr;
+}
+
+void sampler::disarm(thread_state &state) noexcept {
+	if (!state.armed) return;
+	timer_delete(state.timer);
+	state.armed = false;
+}
+
+#else // ^^^ defined(GXZN_CHRONO_LINUX) ^^^ / vvv !defined(GXZN_CHRONO_LINUX) vvv
+
+bool sampler::available() noexcept { return false; }
+
+sampler::sampler(const time interval, const std::size_t capacity)
+	: m_interval{ interval }, m_capacity{ capacity } {}
+
+sampler::~sampler() = default;
+
+bool sampler::attach() { return false; }
+
+void sampler::detach() {}
+
+void sampler::disarm(thread_state &state) noexcept {
+	state.armed = false;
+}
+
+#endif // defined(GXZN_CHRONO_LINUX)
+
+bool sampler::valid() const noexcept {
+	return m_generation != 0;
+}
+
+sample_profile sampler::collect() {
+	std::lock_guard lock{ m_mutex };
+	for (const auto &state : m_threads) {
+		drain(*state);
+	}
+
+	sample_profile result;
+	result.dropped = m_dropped;
+	result.stacks.reserve(std::size(m_stacks));
+	for (const auto &[frames, samples] : m_stacks) {
+		result.stacks.push_back(sampled_stack{ frames, samples });
+	}
+	return result;
+}
+
+time sampler::interval() const noexcept {
+	return m_interval;
+}
+
+void sampler::drain(thread_state &state) {
+	auto &ring{ state.ring };
+	const auto head{ ring.head.load(std::memory_order_acquire) };
+	auto tail{ ring.tail.load(std::memory_order_relaxed) };
+
+	std::vector<std::uintptr_t> frames;
+	for (; tail != head; ++tail) {
+		const auto &record{ ring.records[tail % ring.capacity] };
+		if (record.depth == 0) continue;
+
+		/// The handler captures the innermost frame first
+		frames.assign(std::make_reverse_iterator(record.frames + record.depth), std::make_reverse_iterator(record.frames));
+		++m_stacks[frames];
+	}
+	ring.tail.store(tail, std::memory_order_release);
+	m_dropped += ring.dropped.exchange(0, std::memory_order_relaxed);
+}
+
+} // namespace golxzn::os::chrono::profiler
@@ -0,0 +1,251 @@
+#include "golxzn/os/chrono/shm_clock.hpp"
+
+#include <new>
+#include <algorithm>
+#include <thread>
+
+#if defined(GXZN_CHRONO_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif // defined(GXZN_CHRONO_WINDOWS)
+
+namespace golxzn::os::chrono {
+
+namespace {
+
+std::string object_name(const std::string_view name) {
+	if (!name.empty() && name.front() == '/') return std::string{ name };
+	std::string result;
+	result.reserve(name.size() + 1);
+	result.push_back('/');
+	result.append(name);
+	return result;
+}
+
+/// Maps shared memory object. Returns the mapped page and writes OS handle which has to be kept alive.
+void *map(const std::string &name, const bool create, void *&handle) noexcept {
+	constexpr auto size{ sizeof(shm_clock_page) };
+#if defined(GXZN_CHRONO_WINDOWS)
+	handle = create
+		? CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(size), name.c_str())
+		: OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+	if (handle == nullptr) return nullptr;
+	if (create && GetLastError() == ERROR_ALREADY_EXISTS) {
+		CloseHandle(handle); // another publisher owns the page
+		handle = nullptr;
+		return nullptr;
+	}
+
+	void *page{ MapViewOfFile(handle, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, size) };
+	if (page == nullptr) {
+		CloseHandle(handle);
+		handle = nullptr;
+	}
+	return page;
+#else
+	handle = nullptr;
+	/// O_EXCL: a second publisher would interleave writes and unlink the page under the first one
+	const int descriptor{ create
+		? shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644)
+		: shm_open(name.c_str(), O_RDONLY, 0) };
+	if (descriptor < 0) return nullptr;
+
+	if (create && ftruncate(descriptor, static_cast<off_t>(size)) != 0) {
+		close(descriptor);
+		shm_unlink(name.c_str());
+		return nullptr;
+	}
+
+	void *page{ mmap(nullptr, size, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor, 0) };
+	close(descriptor);
+	return page == MAP_FAILED ? nullptr : page;
+#endif // defined(GXZN_CHRONO_WINDOWS)
+}
+
+void unmap(const void *page, void *handle) noexcept {
+#if defined(GXZN_CHRONO_WINDOWS)
+	if (page != nullptr) UnmapViewOfFile(page);
+	if (handle != nullptr) CloseHandle(handle);
+#else
+	static_cast<void>(handle);
+	if (page != nullptr) munmap(const_cast<void *>(page), sizeof(shm_clock_page));
+#endif // defined(GXZN_CHRONO_WINDOWS)
+}
+
+template<class Clock>
+i64 nanoseconds_since_epoch() noexcept {
+	return static_cast<i64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+} // anonymous namespace
+
+shm_clock_publisher::shm_clock_publisher(const std::string_view name, const time interval)
+	: m_name{ object_name(name) }, m_interval{ interval } {
+	if (void *memory{ map(m_name, true, m_handle) }; memory != nullptr) {
+		m_page = new (memory) shm_clock_page{};
+		m_page->version.store(shm_clock_page::expected_version, std::memory_order_relaxed);
+		publish();
+		m_page->magic.store(shm_clock_page::expected_magic, std::memory_order_release);
+	}
+}
+
+shm_clock_publisher::~shm_clock_publisher() {
+#if defined(GOLXZN_MULTITHREADING)
+	stop();
+#endif // defined(GOLXZN_MULTITHREADING)
+
+	if (m_page == nullptr) return;
+
+	m_page->magic.store(0, std::memory_order_release);
+	unmap(m_page, m_handle);
+#if !defined(GXZN_CHRONO_WINDOWS)
+	shm_unlink(m_name.c_str());
+#endif // !defined(GXZN_CHRONO_WINDOWS)
+}
+
+bool shm_clock_publisher::remove(const std::string_view name) noexcept {
+#if defined(GXZN_CHRONO_WINDOWS)
+	static_cast<void>(name);
+	return true; // the mapping disappears with the last handle
+#else
+	return shm_unlink(object_name(name).c_str()) == 0;
+#endif // defined(GXZN_CHRONO_WINDOWS)
+}
+
+bool shm_clock_publisher::valid() const noexcept {
+	return m_page != nullptr;
+}
+
+void shm_clock_publisher::publish() noexcept {
+	if (m_page == nullptr) return;
+
+	const auto steady{ nanoseconds_since_epoch<std::chrono::steady_clock>() };
+	const auto wall{ nanoseconds_since_epoch<std::chrono::system_clock>() };
+
+	const auto sequence{ m_page->sequence.load(std::memory_order_relaxed) };
+	m_page->sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	m_page->steady.store(steady, std::memory_order_relaxed);
+	m_page->wall_offset.store(wall - steady, std::memory_order_relaxed);
+
+	m_page->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+time shm_clock_publisher::interval() const noexcept {
+	return m_interval;
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+void shm_clock_publisher::start() {
+	std::lock_guard lock{ m_mutex };
+	if (m_running || m_page == nullptr) return;
+
+	m_running = true;
+	m_thread = std::thread([this] {
+		std::unique_lock lock{ m_mutex };
+		while (m_running) {
+			publish();
+			m_wakeup.wait_for(lock, m_interval.duration(), [this] { return !m_running; });
+		}
+	});
+}
+
+void shm_clock_publisher::stop() {
+	{
+		std::lock_guard lock{ m_mutex };
+		m_running = false;
+	}
+	m_wakeup.notify_all();
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+}
+#endif // defined(GOLXZN_MULTITHREADING)
+
+shm_clock::shm_clock(const std::string_view name)
+	: m_page{ static_cast<const shm_clock_page *>(map(object_name(name), false, m_handle)) } {}
+
+shm_clock::~shm_clock() {
+	unmap(m_page, m_handle);
+}
+
+bool shm_clock::valid() const noexcept {
+	return m_page != nullptr
+		&& m_page->magic.load(std::memory_order_acquire) == shm_clock_page::expected_magic
+		&& m_page->version.load(std::memory_order_relaxed) == shm_clock_page::expected_version;
+}
+
+shm_clock::time_point shm_clock::now() const noexcept {
+	i64 steady{}, wall_offset{};
+	read(steady, wall_offset);
+	return time_point{ duration{ steady } };
+}
+
+std::chrono::system_clock::time_point shm_clock::wall_now() const noexcept {
+	i64 steady{}, wall_offset{};
+	read(steady, wall_offset);
+	return std::chrono::system_clock::time_point{
+		std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{ steady + wall_offset })
+	};
+}
+
+bool shm_clock::stale() const noexcept {
+	return m_stale_sequence.load(std::memory_order_relaxed) != 0;
+}
+
+void shm_clock::read(i64 &steady, i64 &wall_offset) const noexcept {
+	if (m_page == nullptr) [[unlikely]] return;
+
+	const auto read_system{ [&steady, &wall_offset] {
+		steady = nanoseconds_since_epoch<std::chrono::steady_clock>();
+		wall_offset = nanoseconds_since_epoch<std::chrono::system_clock>() - steady;
+	} };
+
+	/// A live writer keeps the sequence odd for a few stores, so spinning a bit is enough. If it stays
+	/// odd (the publisher died in the middle of writing), the time is read from the system instead,
+	/// and later reads don't wait for the same sequence again.
+	constexpr u32 spins{ 64 };
+	constexpr std::chrono::milliseconds patience{ 1 };
+	std::chrono::steady_clock::time_point give_up{};
+	for (u32 attempt{ 1 };; ++attempt) {
+		const auto sequence{ m_page->sequence.load(std::memory_order_acquire) };
+		if ((sequence & 1) != 0 && sequence == m_stale_sequence.load(std::memory_order_relaxed)) [[unlikely]] {
+			read_system();
+			break;
+		}
+
+		steady = m_page->steady.load(std::memory_order_relaxed);
+		wall_offset = m_page->wall_offset.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if ((sequence & 1) == 0 && sequence == m_page->sequence.load(std::memory_order_relaxed)) [[likely]] {
+			if (m_stale_sequence.load(std::memory_order_relaxed) != 0) [[unlikely]] {
+				m_stale_sequence.store(0, std::memory_order_relaxed);
+			}
+			break;
+		}
+		if (attempt < spins) continue;
+
+		const auto current{ std::chrono::steady_clock::now() };
+		if (attempt == spins) {
+			give_up = current + patience;
+		} else if (current >= give_up) [[unlikely]] {
+			m_stale_sequence.store(sequence | 1, std::memory_order_relaxed);
+			read_system();
+			break;
+		}
+		std::this_thread::yield();
+	}
+
+	/// The system and the published time differ, so switching between them mustn't move time back
+	auto last{ m_last.load(std::memory_order_relaxed) };
+	while (last < steady && !m_last.compare_exchange_weak(last, steady, std::memory_order_relaxed)) {}
+	steady = std::max(steady, last);
+}
+
+} // namespace golxzn::os::chrono
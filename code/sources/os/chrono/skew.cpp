@@ -0,0 +1,85 @@
+#include <numeric>
+#include <algorithm>
+
+#include "golxzn/os/chrono/skew.hpp"
+
+#if defined(GOLXZN_MULTITHREADING)
+#if defined(GXZN_CHRONO_LINUX)
+#include <sched.h>
+#include <pthread.h>
+#elif defined(GXZN_CHRONO_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif // defined(GXZN_CHRONO_LINUX)
+#endif // defined(GOLXZN_MULTITHREADING)
+
+namespace golxzn::os::chrono {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+u64 skew_report::violations() const noexcept {
+	u64 total{};
+	for (const auto &core : cores) total += core.violations;
+	for (const auto &pair : pairs) total += pair.violations;
+	return total;
+}
+
+std::chrono::nanoseconds skew_report::max_offset() const noexcept {
+	std::chrono::nanoseconds result{};
+	for (const auto &pair : pairs) {
+		result = std::max(result, pair.offset < pair.offset.zero() ? -pair.offset : pair.offset);
+	}
+	return result;
+}
+
+bool skew_report::consistent(const std::chrono::nanoseconds tolerance) const noexcept {
+	if (violations() != 0) return false;
+	return std::all_of(std::begin(pairs), std::end(pairs), [tolerance](const pair_skew &pair) {
+		const auto offset{ pair.offset < pair.offset.zero() ? -pair.offset : pair.offset };
+		return offset <= pair.round_trip / 2 + tolerance;
+	});
+}
+
+namespace details {
+
+std::vector<u32> available_cores() {
+	std::vector<u32> cores;
+#if defined(GXZN_CHRONO_LINUX)
+	/// Containers and taskset restrict the set, so not every core up to hardware_concurrency is usable
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+		for (u32 core{}; core < CPU_SETSIZE; ++core) {
+			if (CPU_ISSET(core, &set)) cores.push_back(core);
+		}
+	}
+#endif // defined(GXZN_CHRONO_LINUX)
+	if (cores.empty()) {
+		cores.resize(std::max(std::thread::hardware_concurrency(), 1U));
+		std::iota(std::begin(cores), std::end(cores), u32{});
+	}
+	return cores;
+}
+
+bool pin_current_thread(const u32 core) noexcept {
+#if defined(GXZN_CHRONO_LINUX)
+	if (core >= CPU_SETSIZE) return false;
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(core, &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(GXZN_CHRONO_WINDOWS)
+	if (core >= sizeof(DWORD_PTR) * 8) return false;
+	return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << core) != 0;
+#else
+	(void)core; // there's no thread affinity on macOS
+	return false;
+#endif // defined(GXZN_CHRONO_LINUX)
+}
+
+} // namespace details
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono
@@ -0,0 +1,13 @@
+#include <atomic>
+
+#include "golxzn/os/chrono/time_series.hpp"
+
+namespace golxzn::os::chrono::details {
+
+std::size_t thread_index() noexcept {
+	static std::atomic<std::size_t> next{};
+	thread_local const std::size_t index{ next.fetch_add(1, std::memory_order_relaxed) };
+	return index;
+}
+
+} // namespace golxzn::os::chrono::details
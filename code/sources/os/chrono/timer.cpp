@@ -0,0 +1,26 @@
+#include "golxzn/os/chrono/timer.hpp"
+
+namespace golxzn::os::chrono::details {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+void timer_completion::notify() noexcept {
+	/// Notified under the lock, so the waiter can't destroy the condition before this call returns
+	std::lock_guard lock{ m_mutex };
+	m_done = true;
+	m_condition.notify_all();
+}
+
+void timer_completion::wait() noexcept {
+	std::unique_lock lock{ m_mutex };
+	m_condition.wait(lock, [this] { return m_done; });
+}
+
+bool timer_completion::done() noexcept {
+	std::lock_guard lock{ m_mutex };
+	return m_done;
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono::details
@@ -0,0 +1,49 @@
+#include "golxzn/os/chrono/timer_service.hpp"
+
+#if defined(GOLXZN_MULTITHREADING)
+#if defined(GXZN_CHRONO_LINUX)
+#include <sched.h>
+#elif defined(GXZN_CHRONO_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif // defined(GXZN_CHRONO_LINUX)
+#endif // defined(GOLXZN_MULTITHREADING)
+
+namespace golxzn::os::chrono::details {
+
+#if defined(GOLXZN_MULTITHREADING)
+
+u32 current_core() noexcept {
+#if defined(GXZN_CHRONO_LINUX)
+	/// Served by vDSO on most architectures, so it's cheap enough for every arm
+	if (const auto core{ sched_getcpu() }; core >= 0) [[likely]] return static_cast<u32>(core);
+#endif // defined(GXZN_CHRONO_LINUX)
+
+#if defined(GXZN_CHRONO_WINDOWS)
+	return static_cast<u32>(GetCurrentProcessorNumber());
+#else
+	/// There's no way to ask for the core on macOS, so every thread keeps its own number
+	static std::atomic<u32> next{};
+	thread_local const u32 number{ next.fetch_add(1, std::memory_order_relaxed) };
+	return number;
+#endif // defined(GXZN_CHRONO_WINDOWS)
+}
+
+namespace {
+
+thread_local bool timer_driver{};
+
+} // namespace
+
+bool is_timer_driver() noexcept {
+	return timer_driver;
+}
+
+void mark_timer_driver() noexcept {
+	timer_driver = true;
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
+
+} // namespace golxzn::os::chrono::details
@@ -0,0 +1,45 @@
+#include <thread>
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono auto clock", "[test][os][chrono][auto_clock]") {
+	using golxzn::os::chrono::auto_clock;
+	using golxzn::os::chrono::clock_source;
+
+	REQUIRE(auto_clock::select(1us));
+	REQUIRE_FALSE(auto_clock::select(1ns));
+
+	const auto &probes{ auto_clock::probes() };
+	const auto steady{ std::find_if(std::begin(probes), std::end(probes),
+		[](const auto &probe) { return probe.source == clock_source::steady; }) };
+	REQUIRE(steady != std::end(probes));
+	REQUIRE(steady->available);
+
+	const auto chosen{ std::find_if(std::begin(probes), std::end(probes),
+		[](const auto &probe) { return probe.source == auto_clock::source(); }) };
+	REQUIRE(chosen != std::end(probes));
+	REQUIRE(chosen->available);
+	if (auto_clock::source() != clock_source::steady) {
+		REQUIRE(chosen->resolution <= 1us);
+		REQUIRE(chosen->cost <= steady->cost);
+	}
+	REQUIRE(golxzn::os::chrono::name_of(auto_clock::source()) != "unknown");
+
+	auto previous{ auto_clock::now() };
+	for (int i{}; i < 10000; ++i) {
+		const auto current{ auto_clock::now() };
+		REQUIRE(current >= previous);
+		previous = current;
+	}
+
+	golxzn::os::chrono::fast_clock<auto_clock> clock;
+	std::this_thread::sleep_for(20ms);
+	const auto elapsed{ clock.elapsed() };
+	REQUIRE(elapsed >= 15ms);
+	REQUIRE(elapsed < 2s);
+}
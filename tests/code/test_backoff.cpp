@@ -0,0 +1,159 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono backoff", "[test][os][chrono][backoff][none]") {
+	golxzn::os::chrono::backoff delays{ golxzn::os::chrono::backoff_policy{
+		golxzn::os::chrono::milliseconds(10), golxzn::os::chrono::milliseconds(50), 2.0,
+		golxzn::os::chrono::backoff_jitter::none, 4
+	} };
+
+	REQUIRE(delays.next() == golxzn::os::chrono::milliseconds(10));
+	REQUIRE(delays.next() == golxzn::os::chrono::milliseconds(20));
+	REQUIRE(delays.next() == golxzn::os::chrono::milliseconds(40));
+	REQUIRE_FALSE(delays.exhausted());
+	REQUIRE(delays.next() == golxzn::os::chrono::milliseconds(50));
+	REQUIRE(delays.retries() == 4);
+	REQUIRE(delays.exhausted());
+
+	delays.reset();
+	REQUIRE_FALSE(delays.exhausted());
+	REQUIRE(delays.next() == golxzn::os::chrono::milliseconds(10));
+}
+
+TEST_CASE("Test chrono backoff", "[test][os][chrono][backoff][jitter]") {
+	using golxzn::os::chrono::backoff_jitter;
+	const golxzn::os::chrono::backoff_policy full{
+		golxzn::os::chrono::milliseconds(10), golxzn::os::chrono::time{ 1s }, 2.0, backoff_jitter::full
+	};
+
+	golxzn::os::chrono::backoff first{ full, 42 };
+	golxzn::os::chrono::backoff same{ full, 42 };
+	golxzn::os::chrono::backoff other{ full };
+	bool differs{};
+	auto window{ golxzn::os::chrono::milliseconds(10) };
+	for (int retry{}; retry < 20; ++retry) {
+		const auto delay{ first.next() };
+		REQUIRE(delay == same.next());
+		REQUIRE(delay >= golxzn::os::chrono::time{});
+		REQUIRE(delay <= window);
+		differs = differs || delay != other.next();
+		window = std::min(golxzn::os::chrono::microseconds(window.microseconds() * 2), golxzn::os::chrono::time{ 1s });
+	}
+	REQUIRE(differs);
+
+	auto decorrelated{ full };
+	decorrelated.jitter = backoff_jitter::decorrelated;
+	decorrelated.multiplier = 3.0;
+	golxzn::os::chrono::backoff delays{ decorrelated };
+	for (int retry{}; retry < 100; ++retry) {
+		const auto delay{ delays.next() };
+		REQUIRE(delay >= golxzn::os::chrono::milliseconds(10));
+		REQUIRE(delay <= golxzn::os::chrono::time{ 1s });
+	}
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+
+TEST_CASE("Test chrono retry scheduler", "[test][os][chrono][backoff][retry_scheduler]") {
+	using golxzn::os::chrono::retry_outcome;
+
+	golxzn::os::chrono::sharded_timer_service<> timers{ 2 };
+	golxzn::os::chrono::retry_scheduler<> retries{ timers };
+
+	std::atomic<int> finished{};
+	std::vector<retry_outcome> outcomes(4, retry_outcome::rejected);
+	std::vector<golxzn::u32> attempts(4);
+	const auto done{ [&](const std::size_t index) {
+		return [&, index](const retry_outcome outcome, const golxzn::u32 count) {
+			outcomes[index] = outcome;
+			attempts[index] = count;
+			++finished;
+		};
+	} };
+
+	golxzn::os::chrono::backoff_policy policy{
+		golxzn::os::chrono::milliseconds(1), golxzn::os::chrono::milliseconds(4), 2.0,
+		golxzn::os::chrono::backoff_jitter::full, 5
+	};
+
+	std::atomic<int> failures{ 2 };
+	retries.submit([&failures] { return failures-- <= 0; }, done(0), policy);
+	retries.submit([] { return false; }, done(1), policy);
+
+	auto slow{ policy };
+	slow.initial = golxzn::os::chrono::time{ 1s };
+	slow.cap = slow.initial;
+	slow.jitter = golxzn::os::chrono::backoff_jitter::none;
+	retries.submit([] { return false; }, done(2), slow, golxzn::os::chrono::deadline::after(100ms));
+
+	std::atomic<int> calls{};
+	const auto cancelled{ retries.submit([&calls] { ++calls; return false; }, done(3), slow) };
+	REQUIRE(cancelled != golxzn::os::chrono::retry_scheduler<>::invalid_id);
+
+	golxzn::os::chrono::fast_timer<> limit{ 10s };
+	while (calls == 0 && limit.is_running()) {
+		std::this_thread::sleep_for(1ms);
+	}
+	REQUIRE(retries.cancel(cancelled));
+	REQUIRE_FALSE(retries.cancel(cancelled));
+
+	while (finished < 4 && limit.is_running()) {
+		std::this_thread::sleep_for(1ms);
+	}
+	REQUIRE(finished == 4);
+	REQUIRE(retries.active() == 0);
+
+	REQUIRE(outcomes[0] == retry_outcome::succeeded);
+	REQUIRE(attempts[0] == 3);
+	REQUIRE(outcomes[1] == retry_outcome::exhausted);
+	REQUIRE(attempts[1] == 6);
+	REQUIRE(outcomes[2] == retry_outcome::expired);
+	REQUIRE(attempts[2] == 1);
+	REQUIRE(outcomes[3] == retry_outcome::cancelled);
+	REQUIRE(attempts[3] == 1);
+
+	const auto stats{ retries.stats() };
+	REQUIRE(stats.submitted == 4);
+	REQUIRE(stats.attempts == 11);
+	REQUIRE(stats.succeeded == 1);
+	REQUIRE(stats.exhausted == 1);
+	REQUIRE(stats.expired == 1);
+	REQUIRE(stats.cancelled == 1);
+	REQUIRE(stats.rejected == 0);
+}
+
+TEST_CASE("Test chrono retry scheduler", "[test][os][chrono][backoff][retry_scheduler][many]") {
+	constexpr int operations{ 2000 };
+	std::atomic<int> succeeded{};
+	{
+		golxzn::os::chrono::retry_scheduler<> retries;
+		std::vector<std::atomic<int>> failures(operations);
+		for (int index{}; index < operations; ++index) {
+			failures[index] = 2;
+			retries.submit([&failures, index] { return failures[index]-- <= 0; },
+				[&succeeded](const golxzn::os::chrono::retry_outcome outcome, const golxzn::u32) {
+					if (outcome == golxzn::os::chrono::retry_outcome::succeeded) ++succeeded;
+				},
+				golxzn::os::chrono::backoff_policy{ golxzn::os::chrono::milliseconds(1), golxzn::os::chrono::milliseconds(8) });
+		}
+
+		golxzn::os::chrono::fast_timer<> limit{ 10s };
+		while (retries.active() != 0 && limit.is_running()) {
+			std::this_thread::sleep_for(1ms);
+		}
+		REQUIRE(retries.stats().attempts == static_cast<golxzn::u64>(operations * 3));
+
+		/// The destructor cancels the operation which waits for its second attempt
+		retries.submit([] { return false; }, {}, golxzn::os::chrono::backoff_policy{ golxzn::os::chrono::time{ 1s } });
+	}
+	REQUIRE(succeeded == operations);
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
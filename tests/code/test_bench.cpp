@@ -0,0 +1,48 @@
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono bench", "[test][os][chrono][bench]") {
+	namespace bench = golxzn::os::chrono::bench;
+
+	bench::options opts;
+	opts.warmup = golxzn::os::chrono::time{ 1ms };
+	opts.sample_target = golxzn::os::chrono::time{ 100us };
+	opts.samples = 20;
+
+	golxzn::u64 counter{};
+	const auto stats{ bench::run([&counter] { return ++counter; }, opts) };
+	REQUIRE(counter > 0);
+	REQUIRE(stats.iterations > 1);
+	REQUIRE(stats.samples + stats.outliers == opts.samples);
+	REQUIRE(stats.mean.lower <= stats.mean.point);
+	REQUIRE(stats.mean.point <= stats.mean.upper);
+	REQUIRE(stats.median.lower <= stats.median.upper);
+
+	const auto json{ bench::to_json(stats, "increment") };
+	REQUIRE(json.find(R"("name":"increment")") != std::string::npos);
+	REQUIRE(json.find(R"("median":{"value":)") != std::string::npos);
+}
+
+TEST_CASE("Test chrono bench", "[test][os][chrono][bench][analyze]") {
+	namespace bench = golxzn::os::chrono::bench;
+
+	std::vector<golxzn::f64> samples;
+	for (int i{}; i < 99; ++i) {
+		samples.push_back(2000.0 + (i % 10) * 10.0);
+	}
+	samples.push_back(1'000'000.0);
+
+	const auto stats{ bench::analyze(samples, 2, 0.0) };
+	REQUIRE(stats.outliers == 1);
+	REQUIRE(stats.samples == 99);
+	REQUIRE(stats.median.point == 1020.0);
+	REQUIRE(stats.mad.point > 0.0);
+	REQUIRE(stats.mean.point < 1050.0);
+	REQUIRE(stats.median.value() == 1us);
+}
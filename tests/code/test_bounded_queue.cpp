@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+#if defined(GOLXZN_MULTITHREADING)
+
+TEST_CASE("Test chrono bounded queue", "[test][os][chrono][bounded_queue]") {
+	golxzn::os::chrono::bounded_queue<std::string> queue{ 3 };
+	REQUIRE(queue.capacity() == 4);
+	REQUIRE(queue.empty());
+
+	const std::string first{ "first" };
+	REQUIRE(queue.try_push(first));
+	REQUIRE(queue.try_push(std::string{ "second" }));
+	REQUIRE(queue.try_push("third"));
+	REQUIRE(queue.try_push("fourth"));
+	REQUIRE(queue.size() == 4);
+
+	std::string rejected{ "rejected" };
+	REQUIRE_FALSE(queue.try_push(std::move(rejected)));
+	REQUIRE(rejected == "rejected");
+
+	std::string value;
+	REQUIRE(queue.try_pop(value));
+	REQUIRE(value == "first");
+	REQUIRE(queue.try_pop(value));
+	REQUIRE(value == "second");
+	REQUIRE(queue.size() == 2);
+
+	/// Remaining values are destroyed with the queue
+}
+
+TEST_CASE("Test chrono bounded queue", "[test][os][chrono][bounded_queue][timeout]") {
+	golxzn::os::chrono::bounded_queue<int> queue{ 1 };
+	REQUIRE(queue.capacity() == 2);
+	int value{};
+
+	golxzn::os::chrono::fast_clock<> pop_clock;
+	REQUIRE_FALSE(queue.try_pop_for(value, 20ms));
+	REQUIRE(pop_clock.elapsed() >= golxzn::os::chrono::milliseconds(20));
+
+	REQUIRE(queue.try_push(1));
+	REQUIRE(queue.try_push(2));
+	golxzn::os::chrono::fast_clock<> push_clock;
+	REQUIRE_FALSE(queue.try_push_for(3, golxzn::os::chrono::milliseconds(20)));
+	REQUIRE(push_clock.elapsed() >= golxzn::os::chrono::milliseconds(20));
+
+	REQUIRE_FALSE(queue.try_push_until(4, golxzn::os::chrono::deadline::after(-1ms)));
+	REQUIRE(queue.try_pop_until(value, golxzn::os::chrono::deadline::never()));
+	REQUIRE(value == 1);
+}
+
+namespace {
+
+struct counted_conversion {
+	static inline int conversions{};
+
+	int value{};
+
+	counted_conversion() = default;
+	counted_conversion(const std::string &text) : value{ std::stoi(text) } { ++conversions; }
+};
+
+} // namespace
+
+TEST_CASE("Test chrono bounded queue", "[test][os][chrono][bounded_queue][conversion]") {
+	golxzn::os::chrono::bounded_queue<counted_conversion> queue{ 1 };
+	REQUIRE(queue.try_push(std::string{ "1" }));
+	REQUIRE(queue.try_push(std::string{ "2" }));
+	counted_conversion::conversions = 0;
+
+	/// Every retry pushes the object converted before the first one
+	REQUIRE_FALSE(queue.try_push_for(std::string{ "3" }, golxzn::os::chrono::milliseconds(5)));
+	REQUIRE(counted_conversion::conversions == 1);
+
+	counted_conversion value;
+	REQUIRE(queue.try_pop(value));
+	REQUIRE(value.value == 1);
+}
+
+TEST_CASE("Test chrono bounded queue", "[test][os][chrono][bounded_queue][wakeup]") {
+	golxzn::os::chrono::bounded_queue<std::unique_ptr<int>> queue{ 1 };
+
+	std::thread consumer{ [&queue] {
+		std::unique_ptr<int> value;
+		REQUIRE(queue.try_pop_for(value, 10s));
+		REQUIRE(*value == 42);
+		REQUIRE(queue.try_pop_for(value, 10s));
+		REQUIRE(*value == 43);
+	} };
+
+	golxzn::os::chrono::fast_clock<> clock;
+	std::this_thread::sleep_for(10ms);
+	REQUIRE(queue.try_push(std::make_unique<int>(42)));
+	REQUIRE(queue.try_push_for(std::make_unique<int>(43), 10s));
+	consumer.join();
+	REQUIRE(clock.elapsed() < golxzn::os::chrono::milliseconds(5000));
+}
+
+TEST_CASE("Test chrono bounded queue", "[test][os][chrono][bounded_queue][threads]") {
+	constexpr int producers{ 3 };
+	constexpr int consumers{ 3 };
+	constexpr int per_producer{ 20'000 };
+	golxzn::os::chrono::bounded_queue<int> queue{ 64 };
+
+	std::atomic<long long> sum{};
+	std::atomic<int> received{};
+	std::vector<std::thread> threads;
+	for (int producer{}; producer < producers; ++producer) {
+		threads.emplace_back([&queue] {
+			for (int value{ 1 }; value <= per_producer; ++value) {
+				REQUIRE(queue.try_push_for(value, 10s));
+			}
+		});
+	}
+	for (int consumer{}; consumer < consumers; ++consumer) {
+		threads.emplace_back([&queue, &sum, &received] {
+			int value{};
+			while (received.load() < producers * per_producer) {
+				if (queue.try_pop_for(value, 1ms)) {
+					sum.fetch_add(value);
+					received.fetch_add(1);
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	REQUIRE(received.load() == producers * per_producer);
+	REQUIRE(sum.load() == static_cast<long long>(producers) * per_producer * (per_producer + 1) / 2);
+	REQUIRE(queue.empty());
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
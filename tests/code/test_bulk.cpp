@@ -0,0 +1,45 @@
+#include <array>
+#include <vector>
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+
+TEST_CASE("Test chrono bulk", "[test][os][chrono][bulk]") {
+	using namespace std::chrono_literals;
+	namespace chrono = golxzn::os::chrono;
+
+	std::vector<chrono::time> values;
+	for (golxzn::i64 i{}; i < 37; ++i) {
+		values.emplace_back(std::chrono::microseconds{ (i * 7919) % 1000 - 500 });
+	}
+
+	std::vector<float> seconds(values.size());
+	std::vector<golxzn::i32> milliseconds(values.size());
+	chrono::bulk::to_seconds(values, seconds);
+	chrono::bulk::to_milliseconds(values, milliseconds);
+	for (std::size_t i{}; i < values.size(); ++i) {
+		REQUIRE(seconds[i] == values[i].seconds<float>());
+		REQUIRE(milliseconds[i] == values[i].milliseconds());
+	}
+
+	const auto [lowest, highest] = std::minmax_element(std::begin(values), std::end(values));
+	REQUIRE(chrono::bulk::min(values) == *lowest);
+	REQUIRE(chrono::bulk::max(values) == *highest);
+	REQUIRE(chrono::bulk::sum(values) == std::accumulate(std::begin(values), std::end(values), chrono::time{}));
+
+	auto shifted{ values };
+	chrono::bulk::add(shifted, chrono::time{ 1ms });
+	chrono::bulk::subtract(shifted, chrono::time{ 250us });
+	for (std::size_t i{}; i < values.size(); ++i) {
+		REQUIRE(shifted[i] == values[i] + chrono::time{ 750us });
+	}
+
+	chrono::bulk::clamp(values, chrono::time{ -100us }, chrono::time{ 100us });
+	REQUIRE(chrono::bulk::min(values) == -100us);
+	REQUIRE(chrono::bulk::max(values) == 100us);
+	REQUIRE(chrono::bulk::min(values.data(), 0) == chrono::time::zero());
+}
@@ -0,0 +1,50 @@
+#include <atomic>
+#include <type_traits>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono deadline", "[test][os][chrono][deadline]") {
+	using golxzn::os::chrono::deadline;
+
+	static_assert(sizeof(deadline) == sizeof(deadline::time_point));
+	static_assert(std::is_trivially_copyable_v<deadline>);
+
+	const auto outer{ deadline::after(1h) };
+	const auto inner{ deadline::after(10ms) };
+	REQUIRE(min(outer, inner) == inner);
+	REQUIRE(min(deadline::never(), outer) == outer);
+	REQUIRE(deadline{}.is_never());
+	REQUIRE_FALSE(outer.expired());
+	REQUIRE(outer.remaining() > 59min);
+	REQUIRE(deadline::after(-1ms).expired());
+	REQUIRE(deadline::after(-1ms).remaining() == golxzn::os::chrono::time::zero());
+
+	std::atomic<deadline> shared{ deadline::never() };
+	REQUIRE(shared.is_lock_free());
+	REQUIRE(tighten(shared, outer));
+	REQUIRE(tighten(shared, inner));
+	REQUIRE_FALSE(tighten(shared, outer));
+	REQUIRE(shared.load() == inner);
+}
+
+TEST_CASE("Test chrono deadline", "[test][os][chrono][deadline][manual_clock]") {
+	using deadline = golxzn::os::chrono::basic_deadline<golxzn::os::chrono::manual_clock>;
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	const auto until{ deadline::after(virtual_time, golxzn::os::chrono::time{ 10ms }) };
+	golxzn::os::chrono::fast_timer timer{ virtual_time, until };
+	REQUIRE(timer.deadline() == until);
+
+	virtual_time.advance(4ms);
+	REQUIRE(until.remaining(virtual_time.now()) == 6ms);
+	REQUIRE(timer.time_left() == 6ms);
+
+	virtual_time.advance(6ms);
+	REQUIRE(until.expired(virtual_time.now()));
+	REQUIRE(timer.is_done());
+}
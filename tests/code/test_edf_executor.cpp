@@ -0,0 +1,151 @@
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+#if defined(GOLXZN_MULTITHREADING)
+
+namespace {
+
+struct gate {
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool entered{};
+	bool opened{};
+
+	void pass() {
+		std::unique_lock lock{ mutex };
+		entered = true;
+		condition.notify_all();
+		condition.wait(lock, [this] { return opened; });
+	}
+	void wait_entered() {
+		std::unique_lock lock{ mutex };
+		condition.wait(lock, [this] { return entered; });
+	}
+	void open() {
+		std::lock_guard lock{ mutex };
+		opened = true;
+		condition.notify_all();
+	}
+};
+
+} // namespace
+
+TEST_CASE("Test chrono edf executor", "[test][os][chrono][edf_executor][order]") {
+	using executor_type = golxzn::os::chrono::edf_executor<golxzn::os::chrono::manual_clock>;
+	using deadline = executor_type::deadline_type;
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	executor_type executor{ virtual_time, 1 };
+	REQUIRE(executor.workers() == 1);
+
+	gate blocker;
+	REQUIRE(executor.submit([&blocker] { blocker.pass(); }, deadline::never()));
+	blocker.wait_entered();
+
+	std::mutex order_mutex;
+	std::vector<int> order;
+	const auto record{ [&](const int value) {
+		return [&, value] {
+			std::lock_guard lock{ order_mutex };
+			order.push_back(value);
+		};
+	} };
+	REQUIRE(executor.submit(record(3), golxzn::os::chrono::milliseconds(30)));
+	REQUIRE(executor.submit(record(1), golxzn::os::chrono::milliseconds(10)));
+	REQUIRE(executor.submit(record(4), deadline::never()));
+	REQUIRE(executor.submit(record(2), 20ms));
+	REQUIRE(executor.submit(record(5), deadline::never()));
+	REQUIRE(executor.pending() == 5);
+
+	blocker.open();
+	executor.stop();
+	REQUIRE_FALSE(executor.submit(record(6), 1ms));
+
+	REQUIRE(order == std::vector<int>{ 1, 2, 3, 4, 5 });
+	const auto stats{ executor.stats() };
+	REQUIRE(stats.submitted == 6);
+	REQUIRE(stats.executed == 6);
+	REQUIRE(stats.dropped == 0);
+	REQUIRE(stats.missed == 0);
+	REQUIRE(stats.miss_rate() == 0.0);
+}
+
+TEST_CASE("Test chrono edf executor", "[test][os][chrono][edf_executor][expired]") {
+	using executor_type = golxzn::os::chrono::edf_executor<golxzn::os::chrono::manual_clock>;
+	using deadline = executor_type::deadline_type;
+	using golxzn::os::chrono::expired_policy;
+
+	for (const auto policy : { expired_policy::run, expired_policy::drop }) {
+		golxzn::os::chrono::manual_clock virtual_time;
+		executor_type executor{ virtual_time, 1, policy };
+
+		gate blocker;
+		REQUIRE(executor.submit([&blocker] { blocker.pass(); }, deadline::never()));
+		blocker.wait_entered();
+
+		std::atomic<int> runs{};
+		std::atomic<int> expirations{};
+		golxzn::os::chrono::time lateness{};
+		REQUIRE(executor.submit([&runs] { ++runs; }, golxzn::os::chrono::milliseconds(5),
+			[&](const golxzn::os::chrono::time late) { lateness = late; ++expirations; }));
+		REQUIRE(executor.submit([&runs] { ++runs; }, golxzn::os::chrono::milliseconds(50)));
+
+		virtual_time.advance(15ms);
+		blocker.open();
+		executor.stop();
+
+		const auto stats{ executor.stats() };
+		if (policy == expired_policy::drop) {
+			REQUIRE(runs == 1);
+			REQUIRE(expirations == 1);
+			REQUIRE(lateness == 10ms);
+			REQUIRE(stats.dropped == 1);
+			REQUIRE(stats.late_starts == 0);
+			REQUIRE(stats.miss_rate() == 1.0 / 3.0);
+		} else {
+			REQUIRE(runs == 2);
+			REQUIRE(expirations == 0);
+			REQUIRE(stats.dropped == 0);
+			REQUIRE(stats.late_starts == 1);
+			REQUIRE(stats.missed == 1);
+			REQUIRE(stats.miss_rate() == 1.0 / 3.0);
+		}
+	}
+}
+
+TEST_CASE("Test chrono edf executor", "[test][os][chrono][edf_executor][stealing]") {
+	golxzn::os::chrono::edf_executor<> executor{ 4 };
+	REQUIRE(executor.workers() == 4);
+
+	constexpr int tasks{ 2000 };
+	std::atomic<int> done{};
+	std::atomic<int> nested{};
+	for (int index{}; index < tasks; ++index) {
+		REQUIRE(executor.submit([&] {
+			++done;
+			/// Submitted from a worker, so it lands in the worker's own heap
+			if (nested.fetch_add(1) < tasks) {
+				(void)executor.submit([&done] { ++done; }, 10s);
+			}
+		}, 10s));
+	}
+	executor.stop();
+
+	const auto stats{ executor.stats() };
+	REQUIRE(static_cast<golxzn::u64>(done) == stats.executed);
+	REQUIRE(stats.submitted == stats.executed);
+	REQUIRE(stats.executed >= tasks);
+	REQUIRE(executor.pending() == 0);
+	REQUIRE(stats.missed == 0);
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
@@ -0,0 +1,81 @@
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono lateness histogram", "[test][os][chrono][lateness]") {
+	using histogram_t = golxzn::os::chrono::lateness_histogram;
+
+	for (golxzn::u64 value : { 0ull, 1ull, 15ull, 16ull, 17ull, 31ull, 32ull, 1000ull, 123456789ull }) {
+		const auto bucket{ histogram_t::bucket_of(value) };
+		REQUIRE(bucket < histogram_t::buckets_count);
+		REQUIRE(histogram_t::bucket_upper_bound(bucket) >= value);
+		REQUIRE(histogram_t::bucket_upper_bound(bucket) - value <= value / histogram_t::sub_buckets);
+	}
+	REQUIRE(histogram_t::bucket_of(~golxzn::u64{}) == histogram_t::buckets_count - 1);
+
+	histogram_t histogram;
+	REQUIRE(histogram.percentile(0.5) == golxzn::os::chrono::time::zero());
+	for (golxzn::i64 i{ 1 }; i <= 1000; ++i) {
+		histogram.record(golxzn::os::chrono::microseconds(i));
+	}
+	histogram.record(golxzn::os::chrono::microseconds(-5));
+
+	REQUIRE(histogram.count() == 1001);
+	REQUIRE(histogram.max() == golxzn::os::chrono::microseconds(1000));
+	REQUIRE(histogram.mean() == golxzn::os::chrono::microseconds(500));
+
+	const auto p50{ histogram.percentile(0.5).microseconds() };
+	REQUIRE(p50 >= 500);
+	REQUIRE(p50 <= 500 + 500 / 16);
+	REQUIRE(histogram.percentile(1.0) == golxzn::os::chrono::microseconds(1000));
+	REQUIRE(histogram.percentile(0.0) == golxzn::os::chrono::time::zero());
+
+	histogram.reset();
+	REQUIRE(histogram.count() == 0);
+}
+
+TEST_CASE("Test chrono lateness histogram", "[test][os][chrono][lateness][timer]") {
+	golxzn::os::chrono::lateness_histogram histogram;
+	golxzn::os::chrono::lateness::set_sink(&histogram);
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	{
+		golxzn::os::chrono::timer<std::function<void()>, golxzn::os::chrono::manual_clock> timer{
+			virtual_time, 10ms, [] {}
+		};
+		virtual_time.advance(15ms);
+#if !defined(GOLXZN_MULTITHREADING)
+		timer.update();
+#endif // !defined(GOLXZN_MULTITHREADING)
+	}
+
+	golxzn::os::chrono::lateness::set_sink(nullptr);
+	REQUIRE(histogram.count() == 1);
+#if defined(GOLXZN_MULTITHREADING)
+	REQUIRE(histogram.max() == golxzn::os::chrono::time::zero()); // manual clock calls the task at its deadline
+#else
+	REQUIRE(histogram.max() == golxzn::os::chrono::milliseconds(5));
+#endif // defined(GOLXZN_MULTITHREADING)
+}
+
+TEST_CASE("Test chrono lateness histogram", "[test][os][chrono][lateness][timer][default_clock]") {
+	golxzn::os::chrono::lateness_histogram histogram;
+	golxzn::os::chrono::lateness::set_sink(&histogram);
+	{
+		golxzn::os::chrono::timer timer{ 1ms, std::function<void()>{ [] {} } };
+#if !defined(GOLXZN_MULTITHREADING)
+		while (timer.is_running()) {
+			std::this_thread::sleep_for(100us);
+		}
+		timer.update();
+#endif // !defined(GOLXZN_MULTITHREADING)
+	}
+
+	golxzn::os::chrono::lateness::set_sink(nullptr);
+	REQUIRE(histogram.count() == 1);
+}
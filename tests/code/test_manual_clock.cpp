@@ -0,0 +1,102 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono manual clock", "[test][os][chrono][manual_clock][clock]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::fast_clock fast{ virtual_time };
+	golxzn::os::chrono::clock clock{ virtual_time };
+
+	virtual_time.advance(10ms);
+	REQUIRE(fast.elapsed() == 10ms);
+	REQUIRE(clock.elapsed() == 10ms);
+
+	virtual_time.advance(1h);
+	REQUIRE(fast.elapsed() == 1h);
+	REQUIRE(clock.elapsed() == 1h + 10ms);
+}
+
+TEST_CASE("Test chrono manual clock", "[test][os][chrono][manual_clock][fast_timer]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::fast_timer timer{ virtual_time, 10ms };
+
+	virtual_time.advance(9ms);
+	REQUIRE(timer.is_running());
+	REQUIRE(timer.time_left() == 1ms);
+
+	virtual_time.advance(1ms);
+	REQUIRE(timer.is_done());
+	REQUIRE(timer.time_left() == golxzn::os::chrono::time::zero());
+}
+
+TEST_CASE("Test chrono manual clock", "[test][os][chrono][manual_clock][timer]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	std::vector<int> fired;
+	golxzn::os::chrono::timer late{ virtual_time, 2h, [&fired] { fired.push_back(2); } };
+	golxzn::os::chrono::timer early{ virtual_time, 1h, [&fired] { fired.push_back(1); } };
+
+	virtual_time.advance(59min);
+#if !defined(GOLXZN_MULTITHREADING)
+	early.update();
+	late.update();
+#endif // !defined(GOLXZN_MULTITHREADING)
+	REQUIRE(fired.empty());
+
+	virtual_time.advance(3h);
+#if !defined(GOLXZN_MULTITHREADING)
+	early.update();
+	late.update();
+#endif // !defined(GOLXZN_MULTITHREADING)
+	REQUIRE(fired == std::vector<int>{ 1, 2 });
+}
+
+TEST_CASE("Test chrono manual clock", "[test][os][chrono][manual_clock][schedule]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	std::size_t ticks{};
+
+	/// Periodic task which reschedules itself: a day of 1 second ticks
+	std::function<void()> tick = [&] {
+		if (++ticks < 86'400) {
+			virtual_time.schedule(virtual_time.now() + 1s, [&tick] { tick(); });
+		}
+	};
+	virtual_time.schedule(virtual_time.now() + 1s, [&tick] { tick(); });
+
+	const auto cancelled{ virtual_time.schedule(virtual_time.now() + 1s, [] { REQUIRE(false); }) };
+	REQUIRE(virtual_time.cancel(cancelled));
+	REQUIRE_FALSE(virtual_time.cancel(cancelled));
+
+	REQUIRE(virtual_time.advance(24h) == 86'400);
+	REQUIRE(ticks == 86'400);
+	REQUIRE(virtual_time.pending() == 0);
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+TEST_CASE("Test chrono manual clock", "[test][os][chrono][manual_clock][timer][threads]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	std::atomic_bool started{ false };
+	std::atomic_bool finished{ false };
+	std::thread advancer;
+	{
+		golxzn::os::chrono::timer timer{ virtual_time, 1ms, [&started, &finished] {
+			started.store(true);
+			std::this_thread::sleep_for(50ms);
+			finished.store(true);
+		} };
+		advancer = std::thread{ [&virtual_time] { virtual_time.advance(1ms); } };
+		while (!started) {
+			std::this_thread::yield();
+		}
+		/// The task can't be cancelled anymore, so the destructor has to wait for the running callback
+	}
+	REQUIRE(finished == true);
+	advancer.join();
+}
+#endif // defined(GOLXZN_MULTITHREADING)
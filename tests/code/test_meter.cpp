@@ -0,0 +1,78 @@
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono meters", "[test][os][chrono][meter][ewma]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::ewma_meter<golxzn::os::chrono::manual_clock> meter{
+		virtual_time, golxzn::os::chrono::milliseconds(100)
+	};
+	REQUIRE(meter.value() == golxzn::os::chrono::time::zero());
+
+	meter.record(golxzn::os::chrono::milliseconds(10));
+	REQUIRE(meter.value() == golxzn::os::chrono::milliseconds(10));
+
+	/// Simultaneous samples have equal weights
+	meter.record(golxzn::os::chrono::milliseconds(30));
+	REQUIRE(meter.value() == golxzn::os::chrono::milliseconds(20));
+
+	/// After one half life old samples weigh half of the new one: (20 * 2 * 0.5 + 50) / (2 * 0.5 + 1) = 35
+	virtual_time.advance(100ms);
+	meter.record(golxzn::os::chrono::milliseconds(50));
+	REQUIRE(meter.value() == golxzn::os::chrono::milliseconds(35));
+
+	/// Old samples are forgotten after many half lives
+	virtual_time.advance(10s);
+	meter.record(golxzn::os::chrono::milliseconds(1));
+	REQUIRE(meter.value() == golxzn::os::chrono::milliseconds(1));
+}
+
+TEST_CASE("Test chrono meters", "[test][os][chrono][meter][sliding_window]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::sliding_window_meter<golxzn::os::chrono::manual_clock> meter{
+		virtual_time, golxzn::os::chrono::milliseconds(1000), 10
+	};
+	REQUIRE(meter.window() == golxzn::os::chrono::milliseconds(1000));
+	REQUIRE(meter.stats().count == 0);
+
+	for (int i{ 1 }; i <= 10; ++i) {
+		meter.record(golxzn::os::chrono::milliseconds(i));
+		virtual_time.advance(100ms);
+	}
+	auto stats{ meter.stats() };
+	REQUIRE(stats.count == 9); // the first bucket has left the window
+	REQUIRE(stats.max == golxzn::os::chrono::milliseconds(10));
+	REQUIRE(stats.mean == golxzn::os::chrono::milliseconds(6));
+
+	virtual_time.advance(2s);
+	meter.record(golxzn::os::chrono::milliseconds(3));
+	stats = meter.stats();
+	REQUIRE(stats.count == 1);
+	REQUIRE(stats.max == golxzn::os::chrono::milliseconds(3));
+}
+
+TEST_CASE("Test chrono meters", "[test][os][chrono][meter][threads]") {
+	golxzn::os::chrono::ewma_meter<> ewma{ golxzn::os::chrono::milliseconds(100) };
+	golxzn::os::chrono::sliding_window_meter<> window{ golxzn::os::chrono::milliseconds(10000), 4 };
+
+	std::vector<std::thread> threads;
+	for (int i{}; i < 4; ++i) {
+		threads.emplace_back([&] {
+			for (int sample{}; sample < 10000; ++sample) {
+				ewma.record(golxzn::os::chrono::microseconds(500));
+				window.record(golxzn::os::chrono::microseconds(500));
+			}
+		});
+	}
+	for (auto &thread : threads) thread.join();
+
+	REQUIRE(ewma.value() == golxzn::os::chrono::microseconds(500));
+	REQUIRE(window.stats().mean == golxzn::os::chrono::microseconds(500));
+	REQUIRE(window.stats().count > 0);
+}
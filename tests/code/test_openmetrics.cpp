@@ -0,0 +1,172 @@
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+#if defined(GOLXZN_MULTITHREADING) && (defined(GXZN_CHRONO_LINUX) || defined(GXZN_CHRONO_MACOS))
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace {
+
+bool contains(std::string_view text, std::string_view line) {
+	return text.find(line) != std::string_view::npos;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Test chrono openmetrics", "[test][os][chrono][openmetrics]") {
+	golxzn::os::chrono::openmetrics::writer writer;
+
+	SECTION("Histogram") {
+		golxzn::os::chrono::lateness_histogram lateness;
+		lateness.record(golxzn::os::chrono::microseconds(10));
+		lateness.record(golxzn::os::chrono::microseconds(20));
+		lateness.record(golxzn::os::chrono::milliseconds(1500));
+
+		writer.histogram("timer_lateness_seconds", lateness, "Timer lateness");
+		writer.finish();
+
+		const auto text{ writer.text() };
+		CHECK(contains(text, "# TYPE timer_lateness_seconds histogram\n"));
+		CHECK(contains(text, "# HELP timer_lateness_seconds Timer lateness\n"));
+		CHECK(contains(text, "timer_lateness_seconds_bucket{le=\"0.000015\"} 1\n"));
+		CHECK(contains(text, "timer_lateness_seconds_bucket{le=\"0.000031\"} 2\n"));
+		CHECK(contains(text, "timer_lateness_seconds_bucket{le=\"1.048575\"} 2\n"));
+		CHECK(contains(text, "timer_lateness_seconds_bucket{le=\"2.097151\"} 3\n"));
+		CHECK(contains(text, "timer_lateness_seconds_bucket{le=\"+Inf\"} 3\n"));
+		CHECK(contains(text, "timer_lateness_seconds_count 3\n"));
+		CHECK(contains(text, "timer_lateness_seconds_sum 1.500030\n"));
+		CHECK(text.substr(text.size() - 6) == "# EOF\n");
+	}
+
+#if defined(GOLXZN_MULTITHREADING)
+	SECTION("Timer service statistics") {
+		golxzn::os::chrono::manual_clock virtual_time;
+		golxzn::os::chrono::timer_service<golxzn::os::chrono::manual_clock> service{ virtual_time, 2 };
+		(void)service.arm(golxzn::os::chrono::milliseconds(1), [] {});
+		const auto cancelled{ service.arm(golxzn::os::chrono::milliseconds(2), [] {}) };
+		(void)service.arm(golxzn::os::chrono::milliseconds(3), [] {});
+		REQUIRE(service.cancel(cancelled));
+		virtual_time.advance(std::chrono::milliseconds{ 5 });
+		REQUIRE(service.poll() == 1);
+
+		writer.counters("timers", service.stats());
+		const auto text{ writer.text() };
+		CHECK(contains(text, "# TYPE timers_armed counter\n"));
+		CHECK(contains(text, "timers_armed_total 2\n"));
+		CHECK(contains(text, "timers_fired_total 1\n"));
+		CHECK(contains(text, "timers_cancelled_total 1\n"));
+		CHECK(contains(text, "timers_rejected_total 1\n"));
+		CHECK(contains(text, "timers_batches_total 1\n"));
+		CHECK(contains(text, "# TYPE timers_largest_batch gauge\n"));
+		CHECK(contains(text, "timers_largest_batch 2\n"));
+	}
+#endif // defined(GOLXZN_MULTITHREADING)
+
+	SECTION("Help escaping") {
+		writer.counter("requests", golxzn::u64{ 1 }, "Requests to \"/api\" with \\ and\nlines");
+		CHECK(contains(writer.text(), "# HELP requests Requests to \\\"/api\\\" with \\\\ and\\nlines\n"));
+	}
+
+	SECTION("Gauges, counters and summaries") {
+		golxzn::os::chrono::manual_clock virtual_time;
+		golxzn::os::chrono::ewma_meter<golxzn::os::chrono::manual_clock> ewma{
+			virtual_time, golxzn::os::chrono::milliseconds(100)
+		};
+		ewma.record(golxzn::os::chrono::milliseconds(25));
+
+		golxzn::os::chrono::sliding_window_meter<golxzn::os::chrono::manual_clock> window{
+			virtual_time, golxzn::os::chrono::milliseconds(1000), 10
+		};
+		window.record(golxzn::os::chrono::milliseconds(10));
+		window.record(golxzn::os::chrono::milliseconds(30));
+
+		writer.gauge("latency_seconds", ewma);
+		writer.gauge("negative_seconds", golxzn::os::chrono::microseconds(-1500));
+		writer.gauge("ratio", 0.5);
+		writer.counter("ticks", golxzn::u64{ 42 });
+		writer.window("window_seconds", window);
+
+		const auto text{ writer.text() };
+		CHECK(contains(text, "# TYPE latency_seconds gauge\nlatency_seconds 0.025000\n"));
+		CHECK(contains(text, "negative_seconds -0.001500\n"));
+		CHECK(contains(text, "ratio 0.5\n"));
+		CHECK(contains(text, "# TYPE ticks counter\nticks_total 42\n"));
+		CHECK_FALSE(contains(text, "summary"));
+		CHECK(contains(text, "# TYPE window_seconds_window_count gauge\nwindow_seconds_window_count 2\n"));
+		CHECK(contains(text, "# TYPE window_seconds_window_sum gauge\nwindow_seconds_window_sum 0.040000\n"));
+		CHECK(contains(text, "window_seconds_max 0.030000\n"));
+
+		writer.clear();
+		REQUIRE(writer.text().empty());
+	}
+
+	SECTION("File") {
+		writer.counter("ticks", golxzn::u64{ 7 });
+		writer.finish();
+
+		const std::string path{ "test_openmetrics.prom" };
+		REQUIRE(writer.write_file(path));
+
+		std::ifstream file{ path };
+		std::stringstream content;
+		content << file.rdbuf();
+		file.close();
+		REQUIRE(content.str() == writer.text());
+		std::remove(path.c_str());
+	}
+}
+
+#if defined(GOLXZN_MULTITHREADING) && (defined(GXZN_CHRONO_LINUX) || defined(GXZN_CHRONO_MACOS))
+TEST_CASE("Test chrono openmetrics server", "[test][os][chrono][openmetrics][server]") {
+	golxzn::os::chrono::openmetrics::server server{ 0, [](auto &writer) {
+		writer.counter("scrapes", golxzn::u64{ 1 });
+	} };
+	REQUIRE(server.start());
+	REQUIRE(server.port() != 0);
+
+	const auto client{ socket(AF_INET, SOCK_STREAM, 0) };
+	REQUIRE(client >= 0);
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(server.port());
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	REQUIRE(connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+
+	const std::string_view request{ "GET /metrics HTTP/1.0\r\n\r\n" };
+	REQUIRE(send(client, request.data(), request.size(), 0) == static_cast<ssize_t>(request.size()));
+
+	std::string response;
+	char buffer[1024];
+	for (ssize_t received{}; (received = recv(client, buffer, sizeof(buffer), 0)) > 0;) {
+		response.append(buffer, static_cast<std::size_t>(received));
+	}
+	close(client);
+
+	CHECK(contains(response, "HTTP/1.0 200 OK\r\n"));
+	CHECK(contains(response, "Content-Type: application/openmetrics-text"));
+	CHECK(contains(response, "scrapes_total 1\n# EOF\n"));
+
+	/// A silent client only delays the server until the receive timeout
+	const auto silent{ socket(AF_INET, SOCK_STREAM, 0) };
+	REQUIRE(silent >= 0);
+	REQUIRE(connect(silent, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 200 });
+
+	golxzn::os::chrono::fast_clock<> stopping;
+	server.stop();
+	CHECK(stopping.elapsed() < golxzn::os::chrono::milliseconds(5000));
+	close(silent);
+}
+#endif
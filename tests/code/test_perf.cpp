@@ -0,0 +1,23 @@
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono perf clock", "[test][os][chrono][perf]") {
+	golxzn::os::chrono::perf_sample sample;
+	{
+		golxzn::os::chrono::perf_scope<> scope{ sample };
+		std::this_thread::sleep_for(10ms);
+	}
+	REQUIRE(sample.elapsed >= 10ms);
+	REQUIRE(sample.counters_valid == golxzn::os::chrono::perf::available());
+	if (sample.counters_valid) {
+		REQUIRE(sample.counters.instructions > 0);
+	} else {
+		REQUIRE(sample.ipc() == 0.0);
+	}
+}
@@ -0,0 +1,82 @@
+#include <string>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono periodic scheduler", "[test][os][chrono][periodic_scheduler][manual_clock]") {
+	constexpr std::size_t jobs_count{ 1000 };
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::periodic_scheduler<golxzn::os::chrono::manual_clock> scheduler{ virtual_time };
+
+	std::vector<std::size_t> calls(jobs_count);
+	for (std::size_t i{}; i < jobs_count; ++i) {
+		const auto id{ scheduler.add("job-" + std::to_string(i), golxzn::os::chrono::milliseconds(1000), [&calls, i] { ++calls[i]; }) };
+		REQUIRE(id != decltype(scheduler)::invalid_job);
+	}
+	REQUIRE(scheduler.size() == jobs_count);
+	REQUIRE(scheduler.add(golxzn::os::chrono::time::zero(), [] {}) == decltype(scheduler)::invalid_job);
+
+	std::vector<std::size_t> fired_per_tick;
+	for (int tick{}; tick < 100; ++tick) {
+		virtual_time.advance(10ms);
+		fired_per_tick.push_back(scheduler.tick());
+	}
+
+	/// Every job fires exactly once per period and load is spread over 100 ticks (10 jobs per tick on average)
+	REQUIRE(std::all_of(std::begin(calls), std::end(calls), [](const auto count) { return count == 1; }));
+	REQUIRE(*std::max_element(std::begin(fired_per_tick), std::end(fired_per_tick)) < 40);
+	REQUIRE(std::count(std::begin(fired_per_tick), std::end(fired_per_tick), std::size_t{}) < 10);
+
+	/// Late tick doesn't burst: each job fires once
+	virtual_time.advance(5s);
+	REQUIRE(scheduler.tick() == jobs_count);
+}
+
+TEST_CASE("Test chrono periodic scheduler", "[test][os][chrono][periodic_scheduler][set_period]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::periodic_scheduler<golxzn::os::chrono::manual_clock> scheduler{ virtual_time };
+
+	std::size_t calls{};
+	std::size_t observed{};
+	scheduler.on_tick([&observed](auto, const std::size_t fired) { observed += fired; });
+
+	const auto id{ scheduler.add("refresh", golxzn::os::chrono::milliseconds(100), [&calls] { ++calls; }) };
+	const auto same{ scheduler.add("refresh", golxzn::os::chrono::milliseconds(100), [] {}) };
+	REQUIRE(scheduler.next().remaining(virtual_time.now()) <= golxzn::os::chrono::milliseconds(100));
+
+	virtual_time.advance(1s);
+	REQUIRE(scheduler.tick() == 2);
+	REQUIRE(scheduler.remove(same));
+	REQUIRE_FALSE(scheduler.remove(same));
+
+	REQUIRE(scheduler.set_period(id, golxzn::os::chrono::milliseconds(10000)));
+	REQUIRE_FALSE(scheduler.set_period(same, golxzn::os::chrono::milliseconds(10000)));
+	REQUIRE(scheduler.next().remaining(virtual_time.now()) <= golxzn::os::chrono::milliseconds(10000));
+
+	for (int i{}; i < 100; ++i) {
+		virtual_time.advance(100ms);
+		scheduler.tick();
+	}
+	REQUIRE(calls == 2);
+	REQUIRE(observed == 3);
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+TEST_CASE("Test chrono periodic scheduler", "[test][os][chrono][periodic_scheduler][thread]") {
+	golxzn::os::chrono::periodic_scheduler<> scheduler;
+	std::atomic<std::size_t> calls{};
+	scheduler.add(golxzn::os::chrono::milliseconds(5), [&calls] { ++calls; });
+	scheduler.start();
+	std::this_thread::sleep_for(60ms);
+	scheduler.stop();
+	REQUIRE(calls >= 5);
+}
+#endif // defined(GOLXZN_MULTITHREADING)
@@ -0,0 +1,113 @@
+#include <thread>
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+void leaf() {
+	static const golxzn::os::chrono::profiler::site leaf_site{ "test_leaf" };
+	golxzn::os::chrono::profiler::scope scope{ leaf_site };
+	std::this_thread::sleep_for(2ms);
+}
+
+void branch() {
+	static const golxzn::os::chrono::profiler::site branch_site{ "test_branch" };
+	golxzn::os::chrono::profiler::scope scope{ branch_site };
+	leaf();
+	leaf();
+}
+
+const golxzn::os::chrono::profiler::call_path *find(const golxzn::os::chrono::profiler::profile &profile,
+		const std::vector<std::string> &names) {
+	const auto found{ std::find_if(std::begin(profile.paths), std::end(profile.paths), [&names](const auto &path) {
+		if (path.sites.size() != names.size()) return false;
+		for (std::size_t i{}; i < names.size(); ++i) {
+			if (golxzn::os::chrono::profiler::site_name(path.sites[i]) != names[i]) return false;
+		}
+		return true;
+	}) };
+	return found != std::end(profile.paths) ? &*found : nullptr;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Test chrono profiler", "[test][os][chrono][profiler]") {
+	const golxzn::os::chrono::profiler::site same{ "test_leaf" };
+	REQUIRE(golxzn::os::chrono::profiler::site_name(same.id()) == "test_leaf");
+
+	branch();
+	std::thread worker{ [] { branch(); leaf(); } };
+	worker.join();
+
+	const auto profile{ golxzn::os::chrono::profiler::snapshot() };
+
+	const auto *branch_path{ find(profile, { "test_branch" }) };
+	REQUIRE(branch_path != nullptr);
+	REQUIRE(branch_path->calls == 2);
+	REQUIRE(branch_path->inclusive >= golxzn::os::chrono::milliseconds(8));
+	REQUIRE(branch_path->exclusive < branch_path->inclusive);
+
+	const auto *nested_leaf{ find(profile, { "test_branch", "test_leaf" }) };
+	REQUIRE(nested_leaf != nullptr);
+	REQUIRE(nested_leaf->calls == 4);
+	REQUIRE(nested_leaf->max >= golxzn::os::chrono::milliseconds(2));
+	REQUIRE(nested_leaf->exclusive == nested_leaf->inclusive);
+
+	const auto *top_leaf{ find(profile, { "test_leaf" }) };
+	REQUIRE(top_leaf != nullptr);
+	REQUIRE(top_leaf->calls == 1);
+
+	const auto folded{ profile.folded() };
+	REQUIRE(folded.find("test_branch;test_leaf ") != std::string::npos);
+
+	const std::string file_name{ "gxzn_chrono_profile.folded" };
+	REQUIRE(profile.write_folded(file_name));
+	std::ifstream file{ file_name };
+	const std::string written{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+	file.close();
+	std::remove(file_name.c_str());
+	REQUIRE(written == folded);
+}
+
+TEST_CASE("Test chrono profiler", "[test][os][chrono][profiler][overflow]") {
+	static const golxzn::os::chrono::profiler::site outer_site{ "test_overflow_outer" };
+	static const golxzn::os::chrono::profiler::site known_site{ "test_overflow_known" };
+	static const golxzn::os::chrono::profiler::site untracked_site{ "test_overflow_untracked" };
+	const auto dropped{ golxzn::os::chrono::profiler::snapshot().dropped };
+
+	/// The root and two nodes: outer and outer;known
+	golxzn::os::chrono::profiler::set_arena_capacity(3);
+	std::thread worker{ [] {
+		golxzn::os::chrono::profiler::scope outer{ outer_site };
+		{ golxzn::os::chrono::profiler::scope known{ known_site }; }
+		golxzn::os::chrono::profiler::scope untracked{ untracked_site };
+		/// Must not be accumulated to outer;known
+		golxzn::os::chrono::profiler::scope known{ known_site };
+		std::this_thread::sleep_for(10ms);
+	} };
+	worker.join();
+	golxzn::os::chrono::profiler::set_arena_capacity(4096);
+
+	const auto profile{ golxzn::os::chrono::profiler::snapshot() };
+	REQUIRE(profile.dropped == dropped + 2);
+
+	const auto *known_path{ find(profile, { "test_overflow_outer", "test_overflow_known" }) };
+	REQUIRE(known_path != nullptr);
+	REQUIRE(known_path->calls == 1);
+	REQUIRE(known_path->inclusive < golxzn::os::chrono::milliseconds(10));
+
+	const auto *outer_path{ find(profile, { "test_overflow_outer" }) };
+	REQUIRE(outer_path != nullptr);
+	REQUIRE(outer_path->inclusive >= golxzn::os::chrono::milliseconds(10));
+	REQUIRE(outer_path->exclusive < golxzn::os::chrono::milliseconds(10));
+}
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono replay clock", "[test][os][chrono][replay_clock][manual_clock]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::clock_recording recording;
+	golxzn::os::chrono::recording_clock<golxzn::os::chrono::manual_clock> source{ virtual_time, recording };
+
+	std::vector<std::chrono::nanoseconds> observed;
+	{
+		golxzn::os::chrono::fast_clock<golxzn::os::chrono::recording_clock<golxzn::os::chrono::manual_clock>> clock{ source };
+		for (int step{}; step < 100; ++step) {
+			virtual_time.advance(std::chrono::microseconds{ 10 + step % 7 });
+			observed.push_back(source.now().time_since_epoch());
+		}
+		virtual_time.advance(1h);
+		observed.push_back(source.now().time_since_epoch());
+		REQUIRE(clock.elapsed() > golxzn::os::chrono::milliseconds(1000));
+	}
+
+	REQUIRE(recording.streams() == 1);
+	REQUIRE_FALSE(recording.truncated(0));
+	/// Two more reads of fast_clock (start and elapsed), microsecond deltas take three bytes
+	REQUIRE(recording.bytes() < 4 * (observed.size() + 2));
+
+	const std::string path{ "test_replay_clock.gxclk" };
+	REQUIRE(recording.save(path));
+
+	golxzn::os::chrono::clock_recording loaded;
+	REQUIRE(loaded.load(path));
+	std::remove(path.c_str());
+	REQUIRE(loaded.values(0) == recording.values(0));
+
+	golxzn::os::chrono::replay_clock replay{ loaded };
+	const auto total{ replay.remaining() };
+	REQUIRE(total == observed.size() + 2);
+
+	golxzn::os::chrono::fast_clock<golxzn::os::chrono::replay_clock> clock{ replay };
+	for (const auto expected : observed) {
+		REQUIRE(replay.now().time_since_epoch() == expected);
+	}
+	REQUIRE(clock.elapsed() > golxzn::os::chrono::milliseconds(1000));
+	REQUIRE(replay.remaining() == 0);
+
+	/// The stream is over: the last value is repeated
+	const auto last{ replay.now() };
+	REQUIRE(replay.now() == last);
+
+	REQUIRE(replay.bind(0));
+	REQUIRE(replay.remaining() == total);
+	REQUIRE_FALSE(replay.bind(1));
+	REQUIRE(replay.now().time_since_epoch() == 0ns);
+
+	golxzn::os::chrono::clock_recording malformed;
+	REQUIRE_FALSE(malformed.load("missing.gxclk"));
+	REQUIRE(malformed.streams() == 0);
+}
+
+TEST_CASE("Test chrono replay clock", "[test][os][chrono][replay_clock][truncated]") {
+	golxzn::os::chrono::clock_recording recording{ 16 };
+	golxzn::os::chrono::recording_clock<> source{ recording };
+	for (int i{}; i < 100; ++i) {
+		(void)source.now();
+	}
+	REQUIRE(recording.truncated(0));
+	REQUIRE(recording.bytes() <= 16);
+
+	/// Values are the prefix of the real reads
+	const auto values{ recording.values(0) };
+	REQUIRE_FALSE(values.empty());
+	REQUIRE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST_CASE("Test chrono replay clock", "[test][os][chrono][replay_clock][threads]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::clock_recording recording;
+	golxzn::os::chrono::recording_clock<golxzn::os::chrono::manual_clock> source{ virtual_time, recording };
+
+	(void)source.now();
+	virtual_time.advance(5ms);
+	std::thread{ [&source] {
+		(void)source.now();
+		(void)source.now();
+	} }.join();
+
+	REQUIRE(recording.streams() == 2);
+	REQUIRE(recording.values(0) == std::vector<golxzn::i64>{ 0 });
+	REQUIRE(recording.values(1) == std::vector<golxzn::i64>{ 5'000'000, 5'000'000 });
+
+	golxzn::os::chrono::replay_clock replay{ recording };
+	REQUIRE(replay.now().time_since_epoch() == 0ns);
+	std::thread{ [&replay] {
+		REQUIRE(replay.remaining() == 2);
+		REQUIRE(replay.now().time_since_epoch() == 5ms);
+	} }.join();
+}
@@ -0,0 +1,63 @@
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+namespace {
+
+volatile golxzn::u64 sink{};
+
+[[gnu::noinline]] void burn(const golxzn::os::chrono::time duration) {
+	golxzn::os::chrono::fast_timer<> timer{ duration };
+	while (!timer.is_done()) {
+		for (int i{}; i < 1000; ++i) {
+			sink = sink * 6364136223846793005ULL + 1442695040888963407ULL;
+		}
+	}
+}
+
+} // anonymous namespace
+
+TEST_CASE("Test chrono sampler", "[test][os][chrono][profiler][sampler]") {
+	golxzn::os::chrono::profiler::sampler sampler{ golxzn::os::chrono::milliseconds(1), 512 };
+	if (!golxzn::os::chrono::profiler::sampler::available()) {
+		REQUIRE_FALSE(sampler.valid());
+		REQUIRE_FALSE(sampler.attach());
+		return;
+	}
+	REQUIRE(sampler.valid());
+	REQUIRE(sampler.interval() == golxzn::os::chrono::milliseconds(1));
+
+	/// Only one sampler owns the signal
+	golxzn::os::chrono::profiler::sampler second{ golxzn::os::chrono::milliseconds(1) };
+	REQUIRE_FALSE(second.valid());
+	REQUIRE_FALSE(second.attach());
+
+	REQUIRE(sampler.attach());
+	REQUIRE(sampler.attach());
+	burn(golxzn::os::chrono::milliseconds(100));
+	sampler.detach();
+
+	const auto profile{ sampler.collect() };
+	golxzn::u64 samples{ profile.dropped };
+	for (const auto &stack : profile.stacks) {
+		REQUIRE_FALSE(stack.frames.empty());
+		samples += stack.samples;
+	}
+	REQUIRE(samples >= 10);
+
+	const auto folded{ profile.folded() };
+	REQUIRE_FALSE(folded.empty());
+	REQUIRE(folded.back() == '\n');
+	REQUIRE(folded.find(' ') != std::string::npos);
+
+	/// Detached thread isn't sampled anymore
+	burn(golxzn::os::chrono::milliseconds(20));
+	const auto after{ sampler.collect() };
+	golxzn::u64 samples_after{ after.dropped };
+	for (const auto &stack : after.stacks) {
+		samples_after += stack.samples;
+	}
+	REQUIRE(samples_after == samples);
+}
@@ -0,0 +1,68 @@
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono scaled clock", "[test][os][chrono][scaled_clock][manual_clock]") {
+	using scaled_clock = golxzn::os::chrono::scaled_clock<golxzn::os::chrono::manual_clock>;
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	scaled_clock world{ virtual_time };
+	scaled_clock zone{ world, 2.0 };
+	scaled_clock entity{ zone, 0.5 };
+	REQUIRE(world.is_root());
+	REQUIRE_FALSE(entity.is_root());
+
+	virtual_time.advance(10ms);
+	REQUIRE(entity.elapsed() == golxzn::os::chrono::time::zero()); // frame isn't updated yet
+	REQUIRE(world.update() == 10ms);
+	REQUIRE(zone.elapsed() == 20ms);
+	REQUIRE(entity.elapsed() == 10ms);
+
+	zone.pause();
+	REQUIRE(zone.paused());
+	virtual_time.advance(10ms);
+	REQUIRE(entity.update() == 10ms);
+	REQUIRE(world.elapsed() == 20ms);
+	REQUIRE(zone.elapsed() == 20ms);
+	REQUIRE(world.frame() == entity.frame());
+
+	zone.resume();
+	entity.set_rate(3.0);
+	REQUIRE(entity.rate() == 3.0);
+	virtual_time.advance(10ms);
+	world.update();
+	REQUIRE(zone.elapsed() == 40ms);
+	REQUIRE(entity.elapsed() == 70ms);
+
+	scaled_clock late{ world, 1.0 }; // starts at zero in the current frame
+	world.set_rate(0.5);
+	virtual_time.advance(20ms);
+	world.update();
+	REQUIRE(world.elapsed() == 40ms);
+	REQUIRE(late.elapsed() == 10ms);
+	REQUIRE(zone.elapsed() == 60ms);
+}
+
+TEST_CASE("Test chrono scaled clock", "[test][os][chrono][scaled_clock][nested]") {
+	using scaled_clock = golxzn::os::chrono::scaled_clock<golxzn::os::chrono::manual_clock>;
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	scaled_clock root{ virtual_time };
+	std::vector<std::unique_ptr<scaled_clock>> chain;
+	for (int depth{}; depth < 1000; ++depth) {
+		const auto &parent{ chain.empty() ? root : *chain.back() };
+		chain.push_back(std::make_unique<scaled_clock>(parent, depth % 2 == 0 ? 2.0 : 0.5));
+	}
+
+	for (int frame{ 1 }; frame <= 3; ++frame) {
+		virtual_time.advance(1ms);
+		root.update();
+		REQUIRE(chain.back()->elapsed() == golxzn::os::chrono::time{ std::chrono::milliseconds{ frame } });
+		REQUIRE(chain[0]->elapsed() == golxzn::os::chrono::time{ std::chrono::milliseconds{ 2 * frame } });
+	}
+}
@@ -0,0 +1,139 @@
+#include <new>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+#if defined(GXZN_CHRONO_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif // defined(GXZN_CHRONO_LINUX)
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::string test_name(const std::string_view suffix) {
+	return "/gxzn_chrono_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count() % 1'000'000)
+		+ std::string{ suffix };
+}
+
+} // anonymous namespace
+
+TEST_CASE("Test chrono shm clock", "[test][os][chrono][shm_clock][clock]") {
+	const auto name{ test_name("_clock") };
+	golxzn::os::chrono::shm_clock_publisher publisher{ name, golxzn::os::chrono::milliseconds(1) };
+	if (!publisher.valid()) return; // shared memory is unavailable in this environment
+
+	golxzn::os::chrono::shm_clock shared_time{ name };
+	REQUIRE(shared_time.valid());
+
+	const auto published{ shared_time.now() };
+	REQUIRE(published.time_since_epoch() > 0ns);
+	REQUIRE(published.time_since_epoch() <= std::chrono::steady_clock::now().time_since_epoch());
+	REQUIRE(shared_time.now() == published);
+
+	std::this_thread::sleep_for(2ms);
+	publisher.publish();
+	REQUIRE(shared_time.now() - published >= 2ms);
+
+	const auto wall_difference{ std::chrono::system_clock::now() - shared_time.wall_now() };
+	REQUIRE(wall_difference >= 0ns);
+	REQUIRE(wall_difference < 1s);
+
+	golxzn::os::chrono::shm_clock missing{ test_name("_missing") };
+	REQUIRE_FALSE(missing.valid());
+	REQUIRE(missing.now().time_since_epoch() == 0ns);
+}
+
+TEST_CASE("Test chrono shm clock", "[test][os][chrono][shm_clock][fast_timer]") {
+	const auto name{ test_name("_timer") };
+	golxzn::os::chrono::shm_clock_publisher publisher{ name, golxzn::os::chrono::milliseconds(1) };
+	if (!publisher.valid()) return;
+
+	golxzn::os::chrono::shm_clock shared_time{ name };
+	golxzn::os::chrono::fast_timer<golxzn::os::chrono::shm_clock> timer{ shared_time, 5ms };
+	golxzn::os::chrono::fast_clock<golxzn::os::chrono::shm_clock> clock{ shared_time };
+	REQUIRE_FALSE(timer.is_done());
+
+#if defined(GOLXZN_MULTITHREADING)
+	publisher.start();
+	std::this_thread::sleep_for(10ms);
+	publisher.stop();
+#else
+	std::this_thread::sleep_for(10ms);
+	publisher.publish();
+#endif // defined(GOLXZN_MULTITHREADING)
+
+	REQUIRE(timer.is_done());
+	REQUIRE(clock.elapsed() >= 5ms);
+}
+
+TEST_CASE("Test chrono shm clock", "[test][os][chrono][shm_clock][exclusive]") {
+	const auto name{ test_name("_exclusive") };
+	golxzn::os::chrono::shm_clock_publisher publisher{ name, golxzn::os::chrono::milliseconds(1) };
+	if (!publisher.valid()) return;
+
+	{
+		/// The second publisher neither shares nor unlinks the page of the first one
+		golxzn::os::chrono::shm_clock_publisher duplicate{ name, golxzn::os::chrono::milliseconds(1) };
+		REQUIRE_FALSE(duplicate.valid());
+	}
+	golxzn::os::chrono::shm_clock shared_time{ name };
+	REQUIRE(shared_time.valid());
+}
+
+#if defined(GXZN_CHRONO_LINUX)
+TEST_CASE("Test chrono shm clock", "[test][os][chrono][shm_clock][stale]") {
+	const auto name{ test_name("_stale") };
+	const int descriptor{ shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644) };
+	if (descriptor < 0) return;
+	REQUIRE(ftruncate(descriptor, sizeof(golxzn::os::chrono::shm_clock_page)) == 0);
+	void *memory{ mmap(nullptr, sizeof(golxzn::os::chrono::shm_clock_page), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0) };
+	close(descriptor);
+	REQUIRE(memory != MAP_FAILED);
+
+	/// The publisher died in the middle of writing: the sequence stays odd
+	auto *page{ new (memory) golxzn::os::chrono::shm_clock_page{} };
+	page->version.store(golxzn::os::chrono::shm_clock_page::expected_version);
+	page->sequence.store(1);
+	page->magic.store(golxzn::os::chrono::shm_clock_page::expected_magic);
+
+	golxzn::os::chrono::shm_clock shared_time{ name };
+	REQUIRE(shared_time.valid());
+	REQUIRE_FALSE(shared_time.stale());
+
+	const auto before{ std::chrono::steady_clock::now().time_since_epoch() };
+	const auto read{ shared_time.now().time_since_epoch() };
+	REQUIRE(shared_time.stale());
+	REQUIRE(read >= before);
+
+	/// Reads don't wait for the dead writer again
+	golxzn::os::chrono::fast_clock<> reads_clock;
+	auto previous{ read };
+	for (int i{}; i < 100; ++i) {
+		const auto current{ shared_time.now().time_since_epoch() };
+		REQUIRE(current >= previous);
+		previous = current;
+	}
+	REQUIRE(reads_clock.elapsed() < golxzn::os::chrono::milliseconds(50));
+	REQUIRE(shared_time.stale());
+
+	/// The older published time doesn't move the clock back
+	page->sequence.store(2);
+	REQUIRE(shared_time.now().time_since_epoch() >= previous);
+	REQUIRE_FALSE(shared_time.stale());
+
+	const auto later{ previous + std::chrono::seconds{ 1 } };
+	page->steady.store(later.count());
+	REQUIRE(shared_time.now().time_since_epoch() == later);
+
+	munmap(memory, sizeof(golxzn::os::chrono::shm_clock_page));
+	REQUIRE(golxzn::os::chrono::shm_clock_publisher::remove(name));
+	REQUIRE_FALSE(golxzn::os::chrono::shm_clock_publisher::remove(name));
+}
+#endif // defined(GXZN_CHRONO_LINUX)
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+#if defined(GOLXZN_MULTITHREADING)
+
+TEST_CASE("Test chrono skew", "[test][os][chrono][skew]") {
+	auto cores{ golxzn::os::chrono::details::available_cores() };
+	REQUIRE_FALSE(cores.empty());
+	if (cores.size() > 3) cores.resize(3);
+
+	golxzn::os::chrono::skew_options options;
+	options.rounds = 200;
+	options.reads = 1000;
+	options.cores = cores;
+
+	const auto report{ golxzn::os::chrono::check_skew<std::chrono::steady_clock>(options) };
+	REQUIRE(report.cores.size() == cores.size());
+	REQUIRE(report.pairs.size() == cores.size() * (cores.size() - 1) / 2);
+	for (const auto &core : report.cores) {
+		CHECK(core.violations == 0);
+		CHECK(core.cost >= 0ns);
+	}
+	for (const auto &pair : report.pairs) {
+		CHECK(pair.first < pair.second);
+		CHECK(pair.round_trip > 0ns);
+	}
+	REQUIRE(report.violations() == 0);
+	REQUIRE(report.consistent(1ms));
+}
+
+TEST_CASE("Test chrono skew", "[test][os][chrono][skew][manual_clock]") {
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::skew_options options;
+	options.rounds = 10;
+	options.reads = 10;
+	options.cores = { 0, 0 };
+
+	/// Time stands still: nothing is reordered and there's no offset
+	const auto report{ golxzn::os::chrono::check_skew(virtual_time, options) };
+	REQUIRE(report.pairs.size() == 1);
+	REQUIRE(report.pairs.front().offset == 0ns);
+	REQUIRE(report.pairs.front().round_trip == 0ns);
+	REQUIRE(report.cores.front().cost == 0ns);
+	REQUIRE(report.max_offset() == 0ns);
+	REQUIRE(report.consistent());
+
+	golxzn::os::chrono::skew_report skewed;
+	skewed.pairs.push_back(golxzn::os::chrono::pair_skew{ 0, 1, 500ns, 100ns, 0 });
+	REQUIRE(skewed.max_offset() == 500ns);
+	REQUIRE_FALSE(skewed.consistent());
+	REQUIRE(skewed.consistent(450ns));
+	skewed.pairs.front().violations = 1;
+	REQUIRE_FALSE(skewed.consistent(450ns));
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
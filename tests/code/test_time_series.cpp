@@ -0,0 +1,60 @@
+#include <thread>
+#include <vector>
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono time series ring", "[test][os][chrono][time_series][manual_clock]") {
+	enum metric : std::size_t { requests, bytes, count };
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	golxzn::os::chrono::time_series_ring<golxzn::os::chrono::manual_clock> ring{
+		virtual_time, golxzn::os::chrono::milliseconds(1000), 5, metric::count, 2
+	};
+	REQUIRE(ring.intervals() == 5);
+	REQUIRE(ring.series() == metric::count);
+
+	for (golxzn::u64 second{ 1 }; second <= 7; ++second) {
+		for (golxzn::u64 i{}; i < second; ++i) {
+			ring.add(1, metric::requests);
+			ring.add(100, metric::bytes);
+		}
+		ring.add(1, metric::count); // ignored
+		virtual_time.advance(1s);
+	}
+	virtual_time.advance(-1s); // ignored
+	virtual_time.advance(500ms);
+
+	const auto series{ ring.snapshot(metric::requests) };
+	REQUIRE(series.granularity == golxzn::os::chrono::milliseconds(1000));
+	REQUIRE(series.start == golxzn::os::chrono::milliseconds(3000));
+	REQUIRE(series.values == std::vector<golxzn::u64>{ 4, 5, 6, 7, 0 });
+	REQUIRE(ring.snapshot(metric::bytes).values == std::vector<golxzn::u64>{ 400, 500, 600, 700, 0 });
+
+	/// Intervals nobody wrote to are zero, even if their slots keep old values
+	virtual_time.advance(3s);
+	ring.add(2, metric::requests);
+	REQUIRE(ring.snapshot(metric::requests).values == std::vector<golxzn::u64>{ 7, 0, 0, 0, 2 });
+}
+
+TEST_CASE("Test chrono time series ring", "[test][os][chrono][time_series][threads]") {
+	golxzn::os::chrono::time_series_ring<> ring{ golxzn::os::chrono::milliseconds(60000), 3 };
+
+	std::vector<std::thread> threads;
+	for (int i{}; i < 4; ++i) {
+		threads.emplace_back([&ring] {
+			for (int value{}; value < 10000; ++value) ring.add();
+		});
+	}
+	for (auto &thread : threads) thread.join();
+
+	const auto values{ ring.snapshot().values };
+	const auto total{ std::accumulate(std::begin(values), std::end(values), golxzn::u64{}) };
+	REQUIRE(total > 0);
+	REQUIRE(total <= 40000);
+}
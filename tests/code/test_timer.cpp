@@ -1,6 +1,7 @@
 #include <functional>
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
@@ -30,3 +31,54 @@ TEST_CASE("Test chrono timer", "[test][os][chrono][timer]") {
 
 	REQUIRE(executed == true);
 }
+
+#if defined(GOLXZN_MULTITHREADING)
+TEST_CASE("Test chrono timer", "[test][os][chrono][timer][nested]") {
+	std::atomic_bool outer_executed{ false };
+	std::atomic_bool nested_executed{ false };
+	golxzn::os::chrono::time outer_duration{};
+	{
+		/// The nested timer is destroyed on the driver thread, which mustn't wait for its deadline
+		golxzn::os::chrono::timer outer{ 5ms, [&outer_executed, &nested_executed, &outer_duration] {
+			golxzn::os::chrono::fast_clock<> duration;
+			{
+				golxzn::os::chrono::timer nested{ 200ms, [&nested_executed] { nested_executed.store(true); } };
+			}
+			outer_duration = duration.elapsed();
+			outer_executed.store(true);
+		} };
+	}
+	REQUIRE(outer_executed == true);
+	REQUIRE(outer_duration < golxzn::os::chrono::milliseconds(100));
+
+	golxzn::os::chrono::fast_timer<> limit{ 10s };
+	while (!nested_executed && limit.is_running()) {
+		std::this_thread::sleep_for(1ms);
+	}
+	REQUIRE(nested_executed == true);
+}
+
+TEST_CASE("Test chrono timer", "[test][os][chrono][timer][full]") {
+	auto &service{ golxzn::os::chrono::details::shared_timer_service<golxzn::os::chrono::utils::default_base_clock>() };
+	const auto fillers_deadline{ golxzn::os::chrono::deadline::after(10s) };
+	std::vector<golxzn::os::chrono::timer_handle> fillers;
+	for (std::size_t shard{}; shard < service.shards(); ++shard) {
+		while (true) {
+			const auto handle{ service.arm_on(shard, fillers_deadline, [] {}) };
+			if (!handle.valid()) break;
+			fillers.push_back(handle);
+		}
+	}
+
+	std::atomic_bool executed{ false };
+	{
+		/// There's no free slot, so the timer has to take a thread instead of spinning forever
+		golxzn::os::chrono::timer timer{ 5ms, [&executed] { executed.store(true); } };
+	}
+	REQUIRE(executed == true);
+
+	for (const auto handle : fillers) {
+		REQUIRE(service.cancel(handle));
+	}
+}
+#endif // defined(GOLXZN_MULTITHREADING)
@@ -0,0 +1,185 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+#if defined(GOLXZN_MULTITHREADING)
+
+TEST_CASE("Test chrono timer service", "[test][os][chrono][timer_service][manual_clock]") {
+	using service_type = golxzn::os::chrono::timer_service<golxzn::os::chrono::manual_clock>;
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	service_type service{ virtual_time, 2 };
+	REQUIRE(service.capacity() == 2);
+
+	std::vector<int> fired;
+	const auto first{ service.arm(10ms, [&fired] { fired.push_back(1); }) };
+	const auto second{ service.arm(golxzn::os::chrono::milliseconds(20), [&fired] { fired.push_back(2); }) };
+	REQUIRE(first.valid());
+	REQUIRE(second.valid());
+	REQUIRE_FALSE(service.arm(30ms, [&fired] { fired.push_back(3); }).valid());
+
+	REQUIRE(service.poll() == 0);
+	virtual_time.advance(15ms);
+	REQUIRE(service.poll() == 1);
+	REQUIRE(fired == std::vector<int>{ 1 });
+	REQUIRE_FALSE(service.cancel(first));
+
+	/// The freed slot gets a new generation, so the stale handle doesn't match it
+	const auto third{ service.arm(10ms, [&fired] { fired.push_back(3); }) };
+	REQUIRE(third.valid());
+	REQUIRE(third.index == first.index);
+	REQUIRE(third.generation != first.generation);
+	REQUIRE_FALSE(service.cancel(first));
+
+	REQUIRE(service.cancel(second));
+	REQUIRE_FALSE(service.cancel(second));
+	virtual_time.advance(1s);
+	REQUIRE(service.poll() == 1);
+	REQUIRE(fired == std::vector<int>{ 1, 3 });
+
+	const auto stats{ service.stats() };
+	REQUIRE(stats.armed == 3);
+	REQUIRE(stats.fired == 2);
+	REQUIRE(stats.cancelled == 1);
+	REQUIRE(stats.rejected == 1);
+}
+
+TEST_CASE("Test chrono timer service", "[test][os][chrono][timer_service][order]") {
+	using service_type = golxzn::os::chrono::timer_service<golxzn::os::chrono::manual_clock>;
+
+	golxzn::os::chrono::manual_clock virtual_time;
+	service_type service{ virtual_time };
+
+	std::vector<int> fired;
+	std::vector<golxzn::os::chrono::timer_handle> handles;
+	for (int index{}; index < 200; ++index) {
+		handles.push_back(service.arm(golxzn::os::chrono::milliseconds(1 + index % 4), [&fired, index] {
+			fired.push_back(index);
+		}));
+	}
+	REQUIRE(service.poll() == 0);
+	for (std::size_t index{}; index < handles.size(); ++index) {
+		if (index % 4 != 0) {
+			REQUIRE(service.cancel(handles[index])); // most of them are cancelled, so the heap is compacted
+		}
+	}
+
+	virtual_time.advance(10ms);
+	REQUIRE(service.poll() == 50);
+	REQUIRE(fired.size() == 50);
+	for (std::size_t index{}; index < fired.size(); ++index) {
+		REQUIRE(fired[index] == static_cast<int>(index * 4)); // equal deadlines fire in the arm order
+	}
+}
+
+TEST_CASE("Test chrono timer service", "[test][os][chrono][timer_service][threads]") {
+	golxzn::os::chrono::timer_service<> service;
+	service.start();
+	REQUIRE(service.running());
+
+	constexpr int threads_count{ 4 };
+	constexpr int timers{ 500 };
+	std::atomic<int> fired{};
+	std::atomic<int> wrong{};
+	std::atomic<int> cancelled{};
+
+	std::vector<std::thread> threads;
+	for (int thread{}; thread < threads_count; ++thread) {
+		threads.emplace_back([&] {
+			for (int index{}; index < timers; ++index) {
+				const auto keep{ index % 2 == 0 };
+				const auto handle{ service.arm(golxzn::os::chrono::microseconds(100 + index), [&fired, &wrong, keep] {
+					++(keep ? fired : wrong);
+				}) };
+				REQUIRE(handle.valid());
+				if (!keep) {
+					/// Could lose the race with firing: then the timer has been called
+					if (service.cancel(handle)) ++cancelled; else --wrong;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	golxzn::os::chrono::fast_timer<> limit{ 10s };
+	while (service.stats().fired + service.stats().cancelled < static_cast<golxzn::u64>(threads_count * timers)
+		&& limit.is_running()) {
+		std::this_thread::sleep_for(1ms);
+	}
+	service.stop();
+
+	REQUIRE(fired == threads_count * timers / 2);
+	REQUIRE(wrong == 0);
+	const auto stats{ service.stats() };
+	REQUIRE(stats.cancelled == static_cast<golxzn::u64>(cancelled.load()));
+	REQUIRE(stats.armed == static_cast<golxzn::u64>(threads_count * timers));
+	REQUIRE(stats.fired + stats.cancelled == stats.armed);
+	REQUIRE(stats.batches > 0);
+}
+
+TEST_CASE("Test chrono sharded timer service", "[test][os][chrono][timer_service][sharded]") {
+	using service_type = golxzn::os::chrono::sharded_timer_service<>;
+	using golxzn::os::chrono::timer_placement;
+
+	service_type service{ 2, 1 };
+	REQUIRE(service.shards() == 2);
+	REQUIRE(service.local_shard() < service.shards());
+	REQUIRE(service.placement() == timer_placement::local);
+
+	const auto first{ service.arm_on(0, service_type::deadline_type::after(1h), [] {}) };
+	REQUIRE(first.valid());
+	REQUIRE(first.shard == 0);
+	REQUIRE_FALSE(service.arm_on(0, service_type::deadline_type::after(1h), [] {}).valid());
+	REQUIRE_FALSE(service.arm_on(2, service_type::deadline_type::after(1h), [] {}).valid());
+
+	/// The full shard hands the timer to the other one
+	const auto second{ service.arm(1h, [] {}) };
+	REQUIRE(second.valid());
+	REQUIRE(second.shard == 1);
+	REQUIRE_FALSE(service.arm(1h, [] {}).valid());
+
+	REQUIRE(service.cancel(first));
+	REQUIRE(service.cancel(second));
+	REQUIRE_FALSE(service.cancel(second));
+	REQUIRE(service.stats(0).cancelled == 1);
+	REQUIRE(service.stats(1).cancelled == 1);
+	REQUIRE(service.stats().armed == 2);
+	REQUIRE(service.stats().rejected == service.stats(0).rejected + service.stats(1).rejected);
+}
+
+TEST_CASE("Test chrono sharded timer service", "[test][os][chrono][timer_service][sharded][balanced]") {
+	using service_type = golxzn::os::chrono::sharded_timer_service<>;
+
+	service_type service{ 2, 512, golxzn::os::chrono::timer_placement::balanced };
+	for (int index{}; index < 200; ++index) {
+		REQUIRE(service.arm_on(0, service_type::deadline_type::after(1h), [] {}).valid());
+	}
+
+	/// Wherever the thread runs, the overloaded shard 0 isn't used
+	std::atomic<int> fired{};
+	for (int index{}; index < 10; ++index) {
+		const auto handle{ service.arm(1ms, [&fired] { ++fired; }) };
+		REQUIRE(handle.valid());
+		REQUIRE(handle.shard == 1);
+	}
+	REQUIRE(service.migrated() <= 10);
+
+	golxzn::os::chrono::fast_timer<> limit{ 10s };
+	while (fired < 10 && limit.is_running()) {
+		std::this_thread::sleep_for(1ms);
+	}
+	REQUIRE(fired == 10);
+	REQUIRE(service.stats(1).fired == 10);
+	REQUIRE(service.stats(0).fired == 0);
+	REQUIRE(service.stats().armed == 210);
+}
+
+#endif // defined(GOLXZN_MULTITHREADING)
@@ -0,0 +1,61 @@
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <golxzn/os/chrono.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Test chrono watchdog", "[test][os][chrono][watchdog]") {
+	namespace chrono = golxzn::os::chrono;
+
+	chrono::manual_clock virtual_time;
+	std::vector<std::pair<std::string, chrono::time>> stalls;
+	chrono::watchdog dog{ virtual_time, chrono::time{ 100ms },
+		[&stalls](std::string_view name, chrono::time silent) { stalls.emplace_back(name, silent); }
+	};
+	REQUIRE(dog.scan_interval() == 25ms);
+
+	auto alive{ dog.add("alive") };
+	auto stuck{ dog.add("stuck") };
+
+	for (int i{}; i < 8; ++i) {
+		virtual_time.advance(25ms);
+		dog.scan();
+		alive.heartbeat();
+	}
+	REQUIRE(stalls.size() == 1);
+	REQUIRE(stalls.front().first == "stuck");
+	REQUIRE(stalls.front().second == 125ms);
+
+	stuck.heartbeat();
+	virtual_time.advance(25ms);
+	REQUIRE(dog.scan() == 0);
+
+	{ auto temporary{ std::move(stuck) }; }
+	virtual_time.advance(1s);
+	REQUIRE(dog.scan() == 1);
+	REQUIRE(stalls.back().first == "alive");
+}
+
+#if defined(GOLXZN_MULTITHREADING)
+TEST_CASE("Test chrono watchdog", "[test][os][chrono][watchdog][thread]") {
+	namespace chrono = golxzn::os::chrono;
+
+	std::atomic_bool detected{ false };
+	chrono::watchdog<> dog{ chrono::time{ 10ms },
+		[&detected](std::string_view, chrono::time silent) { detected.store(silent > 10ms); }
+	};
+	auto worker{ dog.add("worker") };
+	dog.start();
+
+	const chrono::fast_timer<> limit{ 1s };
+	while (!detected.load() && limit.is_running()) {
+		std::this_thread::sleep_for(1ms);
+	}
+	dog.stop();
+	REQUIRE(detected.load());
+}
+#endif // defined(GOLXZN_MULTITHREADING)
@@ -0,0 +1,78 @@
+/**
+ * @file clock_skew.cpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Checks if timestamps of the clock taken on different cores are ordered and reports
+ * per-core read cost and per-pair offsets. Exits with failure if the clock is inconsistent.
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Usage: clock_skew [clock=steady] [rounds=1000] [tolerance_ns=0]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <cstdlib>
+#include <string_view>
+
+#include <golxzn/os/chrono.hpp>
+
+namespace {
+
+using namespace golxzn;
+
+using check_function = os::chrono::skew_report (*)(const os::chrono::skew_options &options);
+
+struct clock_entry {
+	std::string_view name;
+	check_function check;
+};
+
+/// New clocks are added here
+constexpr clock_entry clocks[]{
+	{ "steady", &os::chrono::check_skew<std::chrono::steady_clock> },
+	{ "high_resolution", &os::chrono::check_skew<std::chrono::high_resolution_clock> },
+	{ "system", &os::chrono::check_skew<std::chrono::system_clock> },
+	{ "auto", &os::chrono::check_skew<os::chrono::auto_clock> },
+};
+
+void print(const os::chrono::skew_report &report) {
+	std::printf("%6s %8s %12s %12s\n", "core", "pinned", "read ns", "violations");
+	for (const auto &core : report.cores) {
+		std::printf("%6u %8s %12lld %12llu\n", core.core, core.pinned ? "yes" : "no",
+			static_cast<long long>(core.cost.count()), static_cast<unsigned long long>(core.violations));
+	}
+
+	std::printf("\n%6s %6s %12s %14s %12s\n", "first", "second", "offset ns", "round trip ns", "violations");
+	for (const auto &pair : report.pairs) {
+		std::printf("%6u %6u %12lld %14lld %12llu\n", pair.first, pair.second,
+			static_cast<long long>(pair.offset.count()), static_cast<long long>(pair.round_trip.count()),
+			static_cast<unsigned long long>(pair.violations));
+	}
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+	const std::string_view name{ argc > 1 ? argv[1] : "steady" };
+	os::chrono::skew_options options;
+	if (argc > 2) options.rounds = static_cast<u32>(std::strtoul(argv[2], nullptr, 10));
+	const std::chrono::nanoseconds tolerance{ argc > 3 ? std::strtoll(argv[3], nullptr, 10) : 0 };
+
+	for (const auto &entry : clocks) {
+		if (entry.name != name) continue;
+
+		const auto report{ entry.check(options) };
+		print(report);
+
+		const auto consistent{ report.consistent(tolerance) };
+		std::printf("\nclock: %s, violations: %llu, max offset: %lld ns, %s\n", std::string{ name }.c_str(),
+			static_cast<unsigned long long>(report.violations()), static_cast<long long>(report.max_offset().count()),
+			consistent ? "consistent" : "INCONSISTENT");
+		return consistent ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	std::fprintf(stderr, "Unknown clock '%s'\n", std::string{ name }.c_str());
+	return EXIT_FAILURE;
+}
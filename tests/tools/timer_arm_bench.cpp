@@ -0,0 +1,131 @@
+/**
+ * @file timer_arm_bench.cpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Measures throughput of arming and cancelling timers from 1 to 64 threads: the lock-free
+ * timer_service and its per-core sharded variant against a timer map behind a mutex.
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Usage: timer_arm_bench [operations_per_thread=100000] [max_threads=64]
+ */
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <string>
+#include <cstdlib>
+#include <functional>
+#include <string_view>
+
+#include <golxzn/os/chrono.hpp>
+
+namespace {
+
+using namespace golxzn;
+
+/// Arms and immediately cancels `operations` timers, returns number of arms retried because the pool was full
+using bench_function = u64 (*)(const std::size_t operations);
+
+struct contender {
+	std::string_view name;
+	bench_function run;
+};
+
+u64 lock_free_service(const std::size_t operations) {
+	static os::chrono::timer_service<> service{ os::chrono::timer_service<>::default_capacity * 16 };
+	static const bool started{ [] { service.start(); return true; }() };
+	(void)started;
+
+	u64 rejected{};
+	for (std::size_t operation{}; operation < operations; ++operation) {
+		auto handle{ service.arm(std::chrono::hours{ 1 }, [] {}) };
+		while (!handle.valid()) {
+			/// The driver hasn't freed cancelled slots yet, give it the core
+			++rejected;
+			std::this_thread::yield();
+			handle = service.arm(std::chrono::hours{ 1 }, [] {});
+		}
+		(void)service.cancel(handle);
+	}
+	return rejected;
+}
+
+u64 sharded_service(const std::size_t operations) {
+	static os::chrono::sharded_timer_service<> service;
+
+	u64 rejected{};
+	for (std::size_t operation{}; operation < operations; ++operation) {
+		auto handle{ service.arm(std::chrono::hours{ 1 }, [] {}) };
+		while (!handle.valid()) {
+			++rejected;
+			std::this_thread::yield();
+			handle = service.arm(std::chrono::hours{ 1 }, [] {});
+		}
+		(void)service.cancel(handle);
+	}
+	return rejected;
+}
+
+u64 mutex_map(const std::size_t operations) {
+	using clock_type = os::chrono::utils::default_base_clock;
+	static std::mutex mutex;
+	static std::multimap<clock_type::time_point, std::function<void()>> timers;
+
+	for (std::size_t operation{}; operation < operations; ++operation) {
+		const auto deadline{ clock_type::now() + std::chrono::hours{ 1 } };
+		std::multimap<clock_type::time_point, std::function<void()>>::iterator handle;
+		{
+			std::lock_guard lock{ mutex };
+			handle = timers.emplace(deadline, [] {});
+		}
+		std::lock_guard lock{ mutex };
+		timers.erase(handle);
+	}
+	return 0;
+}
+
+/// New contenders are added here
+constexpr contender contenders[]{
+	{ "timer-service", &lock_free_service },
+	{ "sharded-service", &sharded_service },
+	{ "mutex-map", &mutex_map },
+};
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+	const std::size_t operations{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000 };
+	const std::size_t max_threads{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 64 };
+
+	std::printf("operations per thread: %zu (arm + cancel)\n", operations);
+	std::printf("%-16s %8s %14s %12s\n", "contender", "threads", "ops/sec", "retries");
+	for (const auto &target : contenders) {
+		(void)target.run(operations); // warm up: allocates the pool and starts the driver
+
+		for (std::size_t threads_count{ 1 }; threads_count <= max_threads; threads_count *= 2) {
+			std::atomic<u64> rejected{};
+			std::vector<std::thread> threads;
+			threads.reserve(threads_count);
+
+			os::chrono::fast_clock<> clock;
+			for (std::size_t thread{}; thread < threads_count; ++thread) {
+				threads.emplace_back([&target, &rejected, operations] {
+					rejected.fetch_add(target.run(operations), std::memory_order_relaxed);
+				});
+			}
+			for (auto &thread : threads) {
+				thread.join();
+			}
+			const auto elapsed{ clock.elapsed().seconds<f64>() };
+
+			std::printf("%-16s %8zu %14.0f %12llu\n", std::string{ target.name }.c_str(), threads_count,
+				elapsed > 0.0 ? static_cast<f64>(operations * threads_count) / elapsed : 0.0,
+				static_cast<unsigned long long>(rejected.load()));
+		}
+	}
+	return EXIT_SUCCESS;
+}
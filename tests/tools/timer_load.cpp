@@ -0,0 +1,178 @@
+/**
+ * @file timer_load.cpp
+ * @author Ruslan Golovinskii (golxzn@gmail.com)
+ * @brief Load test of timer backends: arms N timers with random intervals from M threads and
+ * reports lateness percentiles, CPU usage and fires per second.
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Usage: timer_load [timers=1000] [threads=4] [min_interval_us=1000] [max_interval_us=50000] [backend=all]
+ */
+
+#include <ctime>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string_view>
+
+#include <golxzn/os/chrono.hpp>
+
+namespace {
+
+using namespace golxzn;
+
+struct options {
+	std::size_t timers{ 1000 };
+	std::size_t threads{ 4 };
+	i64 min_interval{ 1000 };
+	i64 max_interval{ 50000 };
+	std::string_view backend{ "all" };
+};
+
+/// Arms `count` timers with intervals from `intervals` and blocks until all of them are fired
+using arm_function = void (*)(const std::vector<os::chrono::time> &intervals, std::atomic<u64> &fired);
+
+struct backend {
+	std::string_view name;
+	arm_function arm;
+};
+
+void timer_objects(const std::vector<os::chrono::time> &intervals, std::atomic<u64> &fired) {
+	using timer_t = os::chrono::timer<std::function<void()>>;
+
+	std::vector<std::unique_ptr<timer_t>> timers;
+	timers.reserve(intervals.size());
+	for (const auto interval : intervals) {
+		timers.push_back(std::make_unique<timer_t>(interval, [&fired] {
+			fired.fetch_add(1, std::memory_order_relaxed);
+		}));
+	}
+	timers.clear(); // waits for every callback
+}
+
+void shared_service(const std::vector<os::chrono::time> &intervals, std::atomic<u64> &fired) {
+	static os::chrono::timer_service<> service{ os::chrono::timer_service<>::default_capacity * 4 };
+	static const bool started{ [] { service.start(); return true; }() };
+	(void)started;
+
+	std::atomic<std::size_t> left{ intervals.size() };
+	for (const auto interval : intervals) {
+		while (!service.arm(interval, [&fired, &left] {
+			fired.fetch_add(1, std::memory_order_relaxed);
+			left.fetch_sub(1, std::memory_order_release);
+		}).valid()) {
+			std::this_thread::yield(); // all slots are busy
+		}
+	}
+	while (left.load(std::memory_order_acquire) != 0) {
+		std::this_thread::sleep_for(std::chrono::microseconds{ 100 });
+	}
+}
+
+void sharded_service(const std::vector<os::chrono::time> &intervals, std::atomic<u64> &fired) {
+	static os::chrono::sharded_timer_service<> service;
+
+	std::atomic<std::size_t> left{ intervals.size() };
+	for (const auto interval : intervals) {
+		while (!service.arm(interval, [&fired, &left] {
+			fired.fetch_add(1, std::memory_order_relaxed);
+			left.fetch_sub(1, std::memory_order_release);
+		}).valid()) {
+			std::this_thread::yield(); // all slots of all shards are busy
+		}
+	}
+	while (left.load(std::memory_order_acquire) != 0) {
+		std::this_thread::sleep_for(std::chrono::microseconds{ 100 });
+	}
+}
+
+/// New timer backends are added here
+constexpr backend backends[]{
+	{ "timer", &timer_objects },
+	{ "timer-service", &shared_service },
+	{ "sharded-service", &sharded_service },
+};
+
+void run(const backend &target, const options &settings) {
+	os::chrono::lateness_histogram histogram;
+	os::chrono::lateness::set_sink(&histogram);
+
+	std::atomic<u64> fired{};
+	std::vector<std::thread> threads;
+	threads.reserve(settings.threads);
+
+	const auto cpu_start{ std::clock() };
+	os::chrono::fast_clock wall;
+	for (std::size_t thread{}; thread < settings.threads; ++thread) {
+		const auto count{ settings.timers / settings.threads + (thread < settings.timers % settings.threads ? 1 : 0) };
+		threads.emplace_back([&target, &fired, &settings, count, seed = thread] {
+			std::mt19937_64 random{ seed };
+			std::uniform_int_distribution<i64> distribution{ settings.min_interval, settings.max_interval };
+
+			std::vector<os::chrono::time> intervals(count);
+			for (auto &interval : intervals) {
+				interval = os::chrono::microseconds(distribution(random));
+			}
+			target.arm(intervals, fired);
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	const auto elapsed{ wall.elapsed().seconds<f64>() };
+	const auto cpu{ static_cast<f64>(std::clock() - cpu_start) / CLOCKS_PER_SEC };
+
+	os::chrono::lateness::set_sink(nullptr);
+
+	std::printf("%-18s %10llu %12.0f %8.1f%% %10lld %10lld %10lld %10lld %10lld\n",
+		std::string{ target.name }.c_str(),
+		static_cast<unsigned long long>(fired.load()),
+		static_cast<f64>(fired.load()) / elapsed,
+		elapsed > 0.0 ? cpu / elapsed * 100.0 : 0.0,
+		static_cast<long long>(histogram.percentile(0.5).microseconds()),
+		static_cast<long long>(histogram.percentile(0.9).microseconds()),
+		static_cast<long long>(histogram.percentile(0.99).microseconds()),
+		static_cast<long long>(histogram.percentile(0.999).microseconds()),
+		static_cast<long long>(histogram.max().microseconds()));
+}
+
+[[nodiscard]] options parse(const int argc, char **argv) {
+	options settings;
+	if (argc > 1) settings.timers = std::strtoull(argv[1], nullptr, 10);
+	if (argc > 2) settings.threads = std::max<std::size_t>(std::strtoull(argv[2], nullptr, 10), 1);
+	if (argc > 3) settings.min_interval = std::strtoll(argv[3], nullptr, 10);
+	if (argc > 4) settings.max_interval = std::max<i64>(std::strtoll(argv[4], nullptr, 10), settings.min_interval);
+	if (argc > 5) settings.backend = argv[5];
+	return settings;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+	const auto settings{ parse(argc, argv) };
+
+	std::printf("timers: %zu, threads: %zu, intervals: [%lld, %lld]us\n", settings.timers, settings.threads,
+		static_cast<long long>(settings.min_interval), static_cast<long long>(settings.max_interval));
+	std::printf("%-18s %10s %12s %9s %10s %10s %10s %10s %10s\n",
+		"backend", "fired", "fires/sec", "cpu", "p50 us", "p90 us", "p99 us", "p99.9 us", "max us");
+
+	bool found{};
+	for (const auto &target : backends) {
+		if (settings.backend != "all" && settings.backend != target.name) continue;
+		found = true;
+		run(target, settings);
+	}
+	if (!found) {
+		std::fprintf(stderr, "Unknown backend '%s'\n", std::string{ settings.backend }.c_str());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}